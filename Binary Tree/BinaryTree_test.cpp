@@ -0,0 +1,376 @@
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include "bintree.hpp"
+#include "bintree_impl.hpp"
+#include "node_pool_allocator.hpp"
+#include "node_pool_allocator_impl.hpp"
+
+// Compares "size()", "select()" and "rank()" of the tree with a sorted array of the same values.
+// Rank of a duplicate is the position of its first occurrence
+template <class Allocator = std::allocator<int>>
+static bool sameOrder(const BinaryTree<int, Allocator> &tree, std::vector<int> values)
+{
+    std::sort(values.begin(), values.end());
+    if (tree.size() != values.size())
+        return false;
+    for (size_t k{0}; k < values.size(); ++k)
+        if (tree.select(k) != values[k] or
+            tree.rank(values[k]) != static_cast<size_t>(std::lower_bound(values.begin(), values.end(), values[k]) - values.begin()))
+            return false;
+
+    try
+    {
+        tree.select(values.size());
+        return false;
+    }
+    catch (const std::out_of_range &)
+    {
+    }
+    return true;
+}
+
+// Tree created from a single value has to count it like any other node
+static bool checkSingleValueCtor()
+{
+    BinaryTree<int> tree{42};
+    bool passed{sameOrder(tree, {42}) and tree.rank(43) == 1 and tree.rank(41) == 0};
+
+    tree.addNode(7);
+    tree.addNode(99);
+    passed = passed and sameOrder(tree, {42, 7, 99});
+
+    const BinaryTree<int> copy{tree};
+    tree.removeNode(42);
+    passed = passed and sameOrder(tree, {7, 99}) and sameOrder(copy, {42, 7, 99});
+
+    if (not passed)
+        std::cerr << "Failed: size()/select() are wrong for the tree created from a single value" << std::endl;
+    return passed;
+}
+
+// Random inserts and removals keep subtree sizes consistent
+static bool checkRandomSelect()
+{
+    std::mt19937 gen(7u);
+    std::uniform_int_distribution<int> distribution(0, 1'000'000);
+
+    BinaryTree<int> tree;
+    std::vector<int> values;
+    while (values.size() < 2'000)
+    {
+        const int value{distribution(gen)};
+        if (std::find(values.begin(), values.end(), value) != values.end())
+            continue;
+        tree.addNode(value);
+        values.push_back(value);
+    }
+    for (size_t i{0}; i < 500; ++i)
+    {
+        tree.removeNode(values.back());
+        values.pop_back();
+    }
+
+    const bool passed{sameOrder(tree, values)};
+    if (not passed)
+        std::cerr << "Failed: select()/rank() differ from the sorted array" << std::endl;
+    return passed;
+}
+
+// Nodes taken from the shared node pool are returned to it by removal and by the dtor
+static bool checkNodePool()
+{
+    NodePool pool;
+    bool passed{true};
+    {
+        BinaryTree<int, NodePoolAllocator<int>> tree{NodePoolAllocator<int>(pool)};
+        std::vector<int> values;
+        for (int value{0}; value < 1'000; value++)
+        {
+            tree.addNode(value * 7 % 1'000);
+            values.push_back(value * 7 % 1'000);
+        }
+        tree.removeNode(0);
+        values.erase(std::find(values.begin(), values.end(), 0));
+        passed = sameOrder(tree, values) and pool.blocksInUse() == values.size();
+    }
+
+    passed = passed and pool.blocksInUse() == 0ul;
+    if (not passed)
+        std::cerr << "Failed: tree with the node pool allocator lost nodes" << std::endl;
+    return passed;
+}
+
+/// Value whose copy ctor throws while 'failCopies' is set
+struct Brittle
+{
+    static inline bool failCopies{};
+
+    int value;
+
+    Brittle(int newValue) : value(newValue) {}
+    Brittle(const Brittle &other) : value(other.value)
+    {
+        if (failCopies)
+            throw std::runtime_error("Brittle: copy failed");
+    }
+    Brittle &operator=(const Brittle &) = default;
+
+    bool operator==(const Brittle &other) const { return value == other.value; }
+    bool operator<(const Brittle &other) const { return value < other.value; }
+    bool operator>(const Brittle &other) const { return value > other.value; }
+};
+
+// Node that couldn't be created mustn't be counted in the left sizes of the nodes on its search path
+static bool checkThrowingInsert()
+{
+    BinaryTree<Brittle> tree;
+    std::vector<int> values{50, 25, 75, 10, 30, 60, 90};
+    for (int value : values)
+        tree.addNode(value);
+
+    // 27 is neither a new min nor a new max: it goes left at 50 and 30
+    Brittle::failCopies = true;
+    bool passed{false};
+    try
+    {
+        tree.addNode(Brittle(27));
+    }
+    catch (const std::runtime_error &)
+    {
+        passed = true;
+    }
+    Brittle::failCopies = false;
+
+    std::sort(values.begin(), values.end());
+    passed = passed and tree.size() == values.size();
+    for (size_t k{0}; passed and k < values.size(); ++k)
+        passed = tree.select(k).value == values[k] and tree.rank(values[k]) == k;
+
+    tree.addNode(27);
+    passed = passed and tree.select(2).value == 27 and tree.select(3).value == 30 and tree.rank(50) == 4;
+    if (not passed)
+        std::cerr << "Failed: throwing insertion changed select()/rank()" << std::endl;
+    return passed;
+}
+
+// Tree of a sorted input is a single chain of nodes: copying and destruction mustn't recurse over its depth
+static bool checkDegenerateTree()
+{
+    constexpr int kDepth{1'000'000};
+    bool passed{true};
+    for (bool ascending : {true, false})
+    {
+        BinaryTree<int> chain;
+        for (int i{0}; i < kDepth; ++i)
+            chain.addNode(ascending ? i : kDepth - 1 - i);
+
+        BinaryTree<int> copy{chain};
+        BinaryTree<int> assigned;
+        assigned.addNode(-1);
+        assigned = copy;
+        chain.removeNode(kDepth / 2);
+
+        for (const BinaryTree<int> *tree : {&copy, &assigned})
+            passed = passed and tree->size() == static_cast<size_t>(kDepth) and tree->select(0) == 0 and
+                     tree->select(kDepth / 2) == kDepth / 2 and tree->rank(kDepth - 1) == static_cast<size_t>(kDepth - 1);
+        passed = passed and chain.size() == static_cast<size_t>(kDepth - 1) and chain.select(kDepth / 2) == kDepth / 2 + 1;
+
+        BinaryTree<int> moved{std::move(copy)};
+        passed = passed and moved.size() == static_cast<size_t>(kDepth) and copy.size() == 0UL;
+        // All the chains are destroyed here
+    }
+
+    if (not passed)
+        std::cerr << "Failed: copy of a degenerate tree differs from the original" << std::endl;
+    return passed;
+}
+
+// Every query from below the min to above the max against "std::lower_bound" on the sorted values
+static bool sameSearch(const FrozenBinaryTree<int> &frozen, const std::vector<int> &sorted)
+{
+    if (frozen.size() != sorted.size() or frozen.empty() != sorted.empty())
+        return false;
+    const int hi{sorted.empty() ? 0 : sorted.back()};
+    for (int value{-2}; value <= hi + 2; ++value)
+    {
+        const auto expected{std::lower_bound(sorted.begin(), sorted.end(), value)};
+        const int *found{frozen.lower_bound(value)};
+        if ((found == nullptr) != (expected == sorted.end()) or (found not_eq nullptr and *found not_eq *expected))
+            return false;
+        if (frozen.contains(value) != std::binary_search(sorted.begin(), sorted.end(), value))
+            return false;
+    }
+    return true;
+}
+
+// Frozen copy answers like the sorted array for empty, full (2^k - 1) and all the other sizes, duplicates included
+static bool checkFreeze()
+{
+    std::mt19937 gen(23u);
+    for (size_t count : {0UL, 1UL, 2UL, 3UL, 5UL, 7UL, 8UL, 100UL, 1023UL, 1024UL, 1025UL, 4099UL})
+    {
+        // Even values only, so odd queries are misses between two values
+        std::uniform_int_distribution<int> distribution(0, static_cast<int>(count));
+        BinaryTree<int> tree;
+        std::vector<int> values;
+        for (size_t i{0}; i < count; ++i)
+        {
+            values.push_back(2 * distribution(gen));
+            tree.addNode(values.back());
+        }
+        std::sort(values.begin(), values.end());
+
+        const FrozenBinaryTree<int> frozen{tree.freeze()};
+        const FrozenBinaryTree<int> fromRange(values.begin(), values.end());
+        FrozenBinaryTree<int> assigned;
+        assigned = frozen;
+        if (not sameSearch(frozen, values) or not sameSearch(fromRange, values) or not sameSearch(assigned, values))
+        {
+            std::cerr << "Failed: frozen tree of " << count << " values differs from std::lower_bound" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// Levels of a perfectly balanced tree of 'count' nodes
+static size_t balancedDepth(size_t count)
+{
+    size_t levels{};
+    for (; count not_eq 0; count /= 2UL)
+        ++levels;
+    return levels;
+}
+
+// Both bulk ctors refuse unsorted input
+static bool rejectsUnsorted(const std::vector<int> &values, size_t threads)
+{
+    try
+    {
+        BinaryTree<int> tree(values.begin(), values.end(), threads);
+        return false;
+    }
+    catch (const std::invalid_argument &)
+    {
+        return true;
+    }
+}
+
+// Trees built from sorted ranges are balanced and ordered, duplicates included; parallel build is used
+// for ranges larger than the parallel grain (32768 values)
+static bool checkBulkCtor()
+{
+    std::mt19937 gen(24u);
+    bool passed{true};
+    for (size_t count : {0UL, 1UL, 2UL, 1000UL, 100'000UL})
+    {
+        std::uniform_int_distribution<int> distribution(0, static_cast<int>(count / 4UL));
+        std::vector<int> values(count);
+        for (int &value : values)
+            value = distribution(gen);
+        std::sort(values.begin(), values.end());
+
+        const BinaryTree<int> single(values.begin(), values.end());
+        const BinaryTree<int> parallel(values.begin(), values.end(), 4UL);
+        for (const BinaryTree<int> *tree : {&single, &parallel})
+        {
+            // Walk through the iterators follows parent links, so the links made by the threads are checked too
+            passed = passed and sameOrder(*tree, values) and tree->getMaxDepth() == balancedDepth(count) and
+                     std::equal(tree->begin(), tree->end(), values.begin(), values.end());
+        }
+
+        // Tree stays usable after the bulk build
+        BinaryTree<int> grown(values.begin(), values.end(), 4UL);
+        grown.addNode(-1);
+        grown.addNode(static_cast<int>(count));
+        values.insert(values.begin(), -1);
+        values.push_back(static_cast<int>(count));
+        passed = passed and sameOrder(grown, values);
+    }
+
+    passed = passed and rejectsUnsorted({1, 3, 2}, 1UL) and rejectsUnsorted({1, 3, 2}, 4UL);
+    if (not passed)
+        std::cerr << "Failed: tree built from a sorted range is unbalanced or has wrong values" << std::endl;
+    return passed;
+}
+
+// Iterator 'it' of the tree is at the same position as 'expected' of the multiset
+static bool samePosition(const BinaryTree<int> &tree, BinaryTree<int>::const_iterator it,
+                         const std::multiset<int> &values, std::multiset<int>::const_iterator expected)
+{
+    return std::distance(tree.begin(), it) == std::distance(values.begin(), expected);
+}
+
+// Walks in both directions, bounds and range scans against "std::multiset" on a tree with duplicates
+static bool checkIterators()
+{
+    BinaryTree<int> empty;
+    bool passed{empty.begin() == empty.end() and empty.lower_bound(0) == empty.end() and
+                empty.upper_bound(0) == empty.end()};
+
+    std::mt19937 gen(25u);
+    std::uniform_int_distribution<int> distribution(0, 500);
+    BinaryTree<int> tree;
+    std::multiset<int> values;
+    for (size_t i{0}; i < 2'000; ++i)
+    {
+        const int value{distribution(gen)};
+        tree.addNode(value);
+        values.insert(value);
+    }
+    for (size_t i{0}; i < 300; ++i)
+    {
+        const int value{distribution(gen)};
+        const auto found{values.find(value)};
+        if (found == values.end())
+            continue;
+        tree.removeNode(value);
+        values.erase(found);
+    }
+
+    passed = passed and std::equal(tree.begin(), tree.end(), values.begin(), values.end());
+    passed = passed and std::equal(std::make_reverse_iterator(tree.end()), std::make_reverse_iterator(tree.begin()),
+                                   values.rbegin(), values.rend());
+
+    // Postfix forms return the old position, "--end()" is the max value
+    auto it{tree.begin()};
+    const int second{*std::next(values.begin())};
+    passed = passed and *it++ == *values.begin() and *it == second and *it-- == second and it == tree.begin();
+    passed = passed and *--tree.end() == *values.rbegin();
+
+    for (int value{-1}; passed and value <= 502; ++value)
+    {
+        const auto lower{tree.lower_bound(value)}, upper{tree.upper_bound(value)};
+        passed = samePosition(tree, lower, values, values.lower_bound(value)) and
+                 samePosition(tree, upper, values, values.upper_bound(value)) and
+                 (lower == tree.end() or *lower == *values.lower_bound(value));
+
+        std::vector<int> range;
+        tree.for_each_in_range(value, value + 37, [&range](const int &found)
+                               { range.push_back(found); });
+        passed = passed and
+                 std::equal(range.begin(), range.end(), values.lower_bound(value), values.lower_bound(value + 37));
+    }
+
+    if (not passed)
+        std::cerr << "Failed: iterators, bounds or range scan differ from std::multiset" << std::endl;
+    return passed;
+}
+
+int main()
+{
+    if (not checkSingleValueCtor() or not checkRandomSelect() or not checkNodePool() or not checkThrowingInsert())
+        return EXIT_FAILURE;
+
+    if (not checkDegenerateTree() or not checkFreeze() or not checkBulkCtor() or not checkIterators())
+        return EXIT_FAILURE;
+
+    std::cout << "Passed" << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,80 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../bintree.hpp"
+#include "../bintree_impl.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Builds the tree by 'build' and prints time of the build and depth of the tree
+ * @param input "sorted" or "random"
+ * @param method way of building
+ */
+template <typename Build>
+void run(std::string const &input, std::string const &method, Build const &build)
+{
+    const auto start{Clock::now()};
+    const BinaryTree<int> tree{build()};
+    const std::chrono::duration<double> elapsed{Clock::now() - start};
+
+    std::cout << std::setw(8) << input << std::setw(30) << method << std::fixed << std::setprecision(3)
+              << std::setw(12) << elapsed.count() << std::setw(12) << tree.getMaxDepth() << '\n';
+}
+
+// Usage: ./bulk_benchmark [count of values, 10'000'000 by default] [count of threads, all cores by default]
+int main(int argc, char *argv[])
+{
+    const size_t count{argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10'000'000UL};
+    const size_t threads{argc > 2 ? std::strtoul(argv[2], nullptr, 10)
+                                  : std::max<size_t>(2UL, std::thread::hardware_concurrency())};
+
+    std::vector<int> sorted(count);
+    std::iota(sorted.begin(), sorted.end(), 0);
+    std::vector<int> random(sorted);
+    std::shuffle(random.begin(), random.end(), std::mt19937(42));
+
+    const std::string parallel{"bulk, " + std::to_string(threads) + " threads"};
+    std::cout << count << " values, " << std::thread::hardware_concurrency() << " cores\n"
+              << std::setw(8) << "input" << std::setw(30) << "method" << std::setw(12) << "build, s"
+              << std::setw(12) << "depth" << '\n';
+
+    // Sorted input takes O(1) append path of 'addNode()', but the tree is a list
+    run("sorted", "addNode()", [&sorted]
+        {
+            BinaryTree<int> tree;
+            for (int value : sorted)
+                tree.addNode(value);
+            return tree; });
+    run("sorted", "bulk", [&sorted]
+        { return BinaryTree<int>(sorted.begin(), sorted.end()); });
+    run("sorted", parallel, [&sorted, threads]
+        { return BinaryTree<int>(sorted.begin(), sorted.end(), threads); });
+
+    run("random", "addNode()", [&random]
+        {
+            BinaryTree<int> tree;
+            for (int value : random)
+                tree.addNode(value);
+            return tree; });
+    // Unsorted input has to be sorted first, sorting is included in the time
+    run("random", "std::sort + bulk", [&random]
+        {
+            std::vector<int> values(random);
+            std::sort(values.begin(), values.end());
+            return BinaryTree<int>(values.begin(), values.end()); });
+    run("random", "std::sort + " + parallel, [&random, threads]
+        {
+            std::vector<int> values(random);
+            std::sort(values.begin(), values.end());
+            return BinaryTree<int>(values.begin(), values.end(), threads); });
+    return 0;
+}
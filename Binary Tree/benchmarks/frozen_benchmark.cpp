@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../bintree.hpp"
+#include "../bintree_impl.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+// Pointer trees bigger than this aren't built: building them takes minutes
+constexpr size_t kMaxPointerTree{10'000'000UL};
+
+// Returns nanoseconds per element of 'queries' spent in 'fn'
+template <typename Fn>
+double measure(std::vector<int> const &queries, Fn const &fn)
+{
+    const auto start{Clock::now()};
+    for (int query : queries)
+        fn(query);
+    const std::chrono::duration<double, std::nano> elapsed{Clock::now() - start};
+    return elapsed.count() / static_cast<double>(queries.size());
+}
+
+std::string format(double ns)
+{
+    if (ns < 0)
+        return "-";
+    std::string str{std::to_string(ns)};
+    return str.substr(0, str.find('.') + 2);
+}
+
+/**
+ * @brief Looks up random values in [0, 2 * count) in trees of 'count' even values:
+ * half of the queries are hits, half are misses
+ */
+void run(size_t count, size_t queriesCount)
+{
+    std::mt19937 gen(42);
+    std::vector<int> sorted(count), queries(queriesCount);
+    for (size_t i{}; i < count; i++)
+        sorted[i] = static_cast<int>(i * 2UL);
+    for (int &query : queries)
+        query = static_cast<int>(gen() % (count * 2UL));
+
+    long long checksum{};
+    double treeNs{-1.0}, freezeS{-1.0};
+    FrozenBinaryTree<int> frozen;
+    if (count <= kMaxPointerTree)
+    {
+        std::vector<int> values(sorted);
+        std::shuffle(values.begin(), values.end(), gen);
+        BinaryTree<int> tree;
+        for (int value : values)
+            tree.addNode(value);
+        values = std::vector<int>();
+
+        // 'rank()' is the lower bound in the pointer tree: it descends to a leaf as the other searches do
+        treeNs = measure(queries, [&tree, &checksum](int value)
+                         { checksum += static_cast<long long>(tree.rank(value)); });
+        const auto start{Clock::now()};
+        frozen = tree.freeze();
+        freezeS = std::chrono::duration<double>(Clock::now() - start).count();
+    }
+    else
+        frozen = FrozenBinaryTree<int>(sorted.begin(), sorted.end());
+
+    const double arrayNs{measure(queries, [&sorted, &checksum](int value)
+                                 {
+                                     const auto it{std::lower_bound(sorted.begin(), sorted.end(), value)};
+                                     checksum += it != sorted.end() ? *it : -1; })};
+    const double frozenNs{measure(queries, [&frozen, &checksum](int value)
+                                  {
+                                      const int *found{frozen.lower_bound(value)};
+                                      checksum += found != nullptr ? *found : -1; })};
+    const double containsNs{measure(queries, [&frozen, &checksum](int value)
+                                    { checksum += frozen.contains(value); })};
+
+    std::cout << std::setw(12) << count << std::setw(12) << (freezeS < 0 ? "-" : std::to_string(freezeS).substr(0, 5))
+              << std::setw(14) << format(treeNs) << std::setw(18) << format(arrayNs) << std::setw(14) << format(frozenNs)
+              << std::setw(12) << format(containsNs) << "    (checksum " << checksum << ")\n";
+}
+
+// Usage: ./frozen_benchmark [counts of values, 1'000 1'000'000 10'000'000 100'000'000 by default]
+int main(int argc, char *argv[])
+{
+    std::vector<size_t> counts{1'000UL, 1'000'000UL, 10'000'000UL, 100'000'000UL};
+    if (argc > 1)
+        counts.clear();
+    for (int i{1}; i < argc; i++)
+        counts.push_back(std::strtoul(argv[i], nullptr, 10));
+
+    std::cout << "1'000'000 random queries, nanoseconds per query\n"
+              << std::setw(12) << "values" << std::setw(12) << "freeze, s" << std::setw(14) << "BinaryTree"
+              << std::setw(18) << "std::lower_bound" << std::setw(14) << "lower_bound" << std::setw(12) << "contains" << '\n';
+    for (size_t count : counts)
+        run(count, 1'000'000UL);
+    return 0;
+}
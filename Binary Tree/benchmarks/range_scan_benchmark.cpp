@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../bintree.hpp"
+#include "../bintree_impl.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+// Returns nanoseconds per value visited by 'scan' for each lower bound in 'starts'
+template <typename Scan>
+double measure(std::vector<int> const &starts, int width, long long &checksum, Scan const &scan)
+{
+    long long visited{};
+    const auto start{Clock::now()};
+    for (int lo : starts)
+        visited += scan(lo, lo + width, checksum);
+    const std::chrono::duration<double, std::nano> elapsed{Clock::now() - start};
+    return elapsed.count() / static_cast<double>(visited);
+}
+
+/**
+ * @brief Scans random ranges of 'width' values in the tree built by 'tree' ("random" - by "addNode()"
+ * in random order, "bulk" - from the sorted range) and in the containers for comparison
+ */
+void run(std::string const &name, BinaryTree<int> const &tree, std::set<int> const &set,
+         std::vector<int> const &sorted, int width)
+{
+    // Each width visits about 10'000'000 values in total
+    const size_t ranges{std::max<size_t>(10UL, 10'000'000UL / static_cast<size_t>(width))};
+    std::mt19937 gen(7);
+    std::vector<int> starts(ranges);
+    for (int &lo : starts)
+        lo = static_cast<int>(gen() % sorted.size());
+
+    long long checksum{};
+    const double forEachNs{measure(starts, width, checksum, [&tree](int lo, int hi, long long &sum)
+                                   {
+                                       long long visited{};
+                                       tree.for_each_in_range(lo, hi, [&sum, &visited](int value)
+                                                              { sum += value, ++visited; });
+                                       return visited; })};
+    const double iteratorNs{measure(starts, width, checksum, [&tree](int lo, int hi, long long &sum)
+                                    {
+                                        long long visited{};
+                                        for (auto it{tree.lower_bound(lo)}; it != tree.end() && *it < hi; ++it, ++visited)
+                                            sum += *it;
+                                        return visited; })};
+    const double setNs{measure(starts, width, checksum, [&set](int lo, int hi, long long &sum)
+                               {
+                                   long long visited{};
+                                   for (auto it{set.lower_bound(lo)}; it != set.end() && *it < hi; ++it, ++visited)
+                                       sum += *it;
+                                   return visited; })};
+    const double arrayNs{measure(starts, width, checksum, [&sorted](int lo, int hi, long long &sum)
+                                 {
+                                     long long visited{};
+                                     for (auto it{std::lower_bound(sorted.begin(), sorted.end(), lo)};
+                                          it != sorted.end() && *it < hi; ++it, ++visited)
+                                         sum += *it;
+                                     return visited; })};
+
+    std::cout << std::setw(8) << name << std::setw(10) << width << std::fixed << std::setprecision(2)
+              << std::setw(20) << forEachNs << std::setw(12) << iteratorNs << std::setw(12) << setNs
+              << std::setw(14) << arrayNs << "    (checksum " << checksum << ")\n";
+}
+
+// Usage: ./range_scan_benchmark [count of values, 1'000'000 by default]
+int main(int argc, char *argv[])
+{
+    const size_t count{argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1'000'000UL};
+
+    std::vector<int> sorted(count);
+    std::iota(sorted.begin(), sorted.end(), 0);
+    std::vector<int> random(sorted);
+    std::shuffle(random.begin(), random.end(), std::mt19937(42));
+
+    BinaryTree<int> randomTree;
+    std::set<int> set;
+    for (int value : random)
+    {
+        randomTree.addNode(value);
+        set.insert(value);
+    }
+    const BinaryTree<int> bulkTree(sorted.begin(), sorted.end());
+
+    std::cout << count << " values, nanoseconds per visited value\n"
+              << std::setw(8) << "tree" << std::setw(10) << "width" << std::setw(20) << "for_each_in_range"
+              << std::setw(12) << "iterators" << std::setw(12) << "std::set" << std::setw(14) << "sorted array" << '\n';
+    for (int width : {10, 1'000, 100'000})
+    {
+        run("random", randomTree, set, sorted, width);
+        run("bulk", bulkTree, set, sorted, width);
+    }
+    return 0;
+}
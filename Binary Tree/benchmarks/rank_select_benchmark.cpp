@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../bintree.hpp"
+#include "../bintree_impl.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+// Returns nanoseconds per element of 'queries' spent in 'fn'
+template <typename Fn>
+double measure(std::vector<size_t> const &queries, Fn const &fn)
+{
+    const auto start{Clock::now()};
+    for (size_t query : queries)
+        fn(query);
+    const std::chrono::duration<double, std::nano> elapsed{Clock::now() - start};
+    return elapsed.count() / static_cast<double>(queries.size());
+}
+
+/**
+ * @brief Builds the tree from 'count' values in random order and runs random "select()" and "rank()" queries.
+ * Tree holds even numbers, so half of "rank()" queries are values that are absent in the tree.
+ * "std::set" has no order statistics: position is found by "std::distance()" from "begin()" - O(n),
+ * so it gets only a few queries
+ */
+void run(size_t count, size_t queriesCount)
+{
+    std::vector<int> values(count);
+    std::iota(values.begin(), values.end(), 0);
+    std::mt19937 gen(42);
+    std::shuffle(values.begin(), values.end(), gen);
+
+    std::vector<size_t> positions(queriesCount), setPositions(std::min<size_t>(queriesCount, 100));
+    for (size_t &position : positions)
+        position = gen() % count;
+    for (size_t &position : setPositions)
+        position = gen() % count;
+
+    BinaryTree<int> tree;
+    const auto start{Clock::now()};
+    for (int value : values)
+        tree.addNode(value * 2);
+    const std::chrono::duration<double> build{Clock::now() - start};
+
+    long long checksum{};
+    const double selectNs{measure(positions, [&tree, &checksum](size_t k)
+                                  { checksum += tree.select(k); })};
+    const double rankNs{measure(positions, [&tree, &checksum](size_t k)
+                                { checksum += static_cast<long long>(tree.rank(static_cast<int>(k))); })};
+
+    // Sorted array is the lower bound: select is indexing, rank is a binary search
+    std::vector<int> sorted(values.size());
+    for (size_t i{}; i < sorted.size(); i++)
+        sorted[i] = static_cast<int>(i) * 2;
+    const double arraySelectNs{measure(positions, [&sorted, &checksum](size_t k)
+                                       { checksum += sorted[k]; })};
+    const double arrayRankNs{measure(positions, [&sorted, &checksum](size_t k)
+                                     { checksum += std::lower_bound(sorted.begin(), sorted.end(), static_cast<int>(k)) -
+                                                   sorted.begin(); })};
+    sorted = std::vector<int>();
+
+    std::set<int> set;
+    for (int value : values)
+        set.insert(value * 2);
+    values = std::vector<int>();
+    const double setRankNs{measure(setPositions, [&set, &checksum](size_t k)
+                                   { checksum += std::distance(set.begin(), set.lower_bound(static_cast<int>(k))); })};
+
+    std::cout << std::setw(12) << count << std::fixed << std::setprecision(2) << std::setw(10) << build.count()
+              << std::setw(12) << selectNs << std::setw(12) << rankNs << std::setw(14) << arraySelectNs
+              << std::setw(14) << arrayRankNs << std::setw(16) << setRankNs << "    (checksum " << checksum << ")\n";
+}
+
+// Usage: ./rank_select_benchmark [counts of nodes, 1'000'000 and 10'000'000 by default]
+int main(int argc, char *argv[])
+{
+    std::vector<size_t> counts{1'000'000UL, 10'000'000UL};
+    if (argc > 1)
+        counts.clear();
+    for (int i{1}; i < argc; i++)
+        counts.push_back(std::strtoul(argv[i], nullptr, 10));
+
+    std::cout << "1'000'000 random queries, nanoseconds per query\n"
+              << std::setw(12) << "nodes" << std::setw(10) << "build, s" << std::setw(12) << "select"
+              << std::setw(12) << "rank" << std::setw(14) << "array select" << std::setw(14) << "array rank"
+              << std::setw(16) << "std::set rank" << '\n';
+    for (size_t count : counts)
+        run(count, 1'000'000UL);
+    return 0;
+}
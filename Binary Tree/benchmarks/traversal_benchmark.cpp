@@ -0,0 +1,61 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../bintree.hpp"
+#include "../bintree_impl.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+// Returns seconds spent in 'fn'
+template <typename Fn>
+double measure(Fn const &fn)
+{
+    const auto start{Clock::now()};
+    fn();
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+void run(std::string const &name, std::vector<int> const &values)
+{
+    auto tree{std::make_unique<BinaryTree<int>>()};
+    size_t depth{};
+
+    const double build{measure([&tree, &values]
+                               { for (int value : values) tree->addNode(value); })};
+    // 'getMaxDepth()' walks all the nodes level by level
+    const double traverse{measure([&tree, &depth]
+                                  { depth = tree->getMaxDepth(); })};
+    const double destroy{measure([&tree]
+                                 { tree.reset(); })};
+
+    std::cout << std::setw(10) << name << std::setw(12) << values.size() << std::setw(12) << depth
+              << std::fixed << std::setprecision(3) << std::setw(12) << build << std::setw(12) << traverse
+              << std::setw(12) << destroy << '\n';
+}
+
+// Usage: ./traversal_benchmark [count of nodes, 10'000'000 by default]
+int main(int argc, char *argv[])
+{
+    const size_t count{argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10'000'000UL};
+
+    std::vector<int> values(count);
+    std::iota(values.begin(), values.end(), 0);
+
+    std::cout << std::setw(10) << "order" << std::setw(12) << "nodes" << std::setw(12) << "depth"
+              << std::setw(12) << "build, s" << std::setw(12) << "traverse, s" << std::setw(12) << "destroy, s" << '\n';
+    // Sorted input makes a skewed tree - linked list of 'count' levels
+    run("sorted", values);
+    std::reverse(values.begin(), values.end());
+    run("reversed", values);
+    std::shuffle(values.begin(), values.end(), std::mt19937(42));
+    run("random", values);
+    return 0;
+}
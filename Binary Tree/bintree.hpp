@@ -3,9 +3,13 @@
 
 #include <string>
 #include <vector>
+#include <iterator>
 #include <memory>
+#include <stdexcept>
 #include <type_traits>
 
+#include "frozen_bintree.hpp"
+
 /*
  * @brief This namespace is created for checking of template types
  * of availability operators ==, < and >
@@ -80,8 +84,12 @@ inline constexpr bool is_comparable_v = checkOperatorsAvailability::has_eq_opera
 
 /*
  * @brief This is an implementation of the binary tree container
- * Container uses smart pointers to store the data, thus there is no memory leaks
- * (checked with Valgrind tool)
+ * Every node is owned by exactly one 'std::unique_ptr' (its parent's link or the root), thus there is no
+ * memory leaks and no reference counting. Traversals walk the tree with raw non-owning pointers
+ * and explicit stacks, so even degenerate (list-like) trees don't overflow the call stack.
+ * Every node knows the size of its left subtree, thus k-th value ("select()") and position of value ("rank()")
+ * are found by one descent from the root. Every node knows its parent, thus iterators walk the tree in sorted
+ * order without a stack
  * @tparam T is the type of stored parameter of the container
  * @tparam Allocator default assigned to an STL allocator class with 'T' type
  */
@@ -95,11 +103,84 @@ private:
     /// Node of the binary tree with hidden implementation, represents a structure of data
     struct Node;
 
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    /// Returns node to the allocator it was taken from
+    struct NodeDeleter
+    {
+        NodeAllocator alloc;
+        void operator()(Node *node) noexcept;
+    };
+
+    /// Owning link to a node
+    using NodePtr = std::unique_ptr<Node, NodeDeleter>;
+
     // Main node (root of binary tree)
-    std::shared_ptr<Node> root;
+    NodePtr root;
+
+    /// Allocator for the nodes, rebound to the node type
+    NodeAllocator alloc;
+
+    // Nodes with min and max values (non-owning, "nullptr" if unknown). Values that are lower than min
+    // or not lower than max are linked to them directly, so sorted input is added in O(1) per node
+    Node *leftmost{};
+    Node *rightmost{};
+
+    // Count of nodes in the tree
+    size_t nodesCount{};
+
+    // Count of nodes linked to 'leftmost' that aren't added to 'leftSize' of the nodes on the left spine
+    // (path from the root that goes only left) yet. Real left size of such node is 'leftSize + leftSpineShift'
+    // (modulo 2^64), so adding a new min value doesn't have to update the whole spine
+    size_t leftSpineShift{};
+
+    /*
+     * @brief Allocates and constructs a node with the allocator of the tree
+     * @tparam value value of the new node
+     * @param parent node that will own the new one, "nullptr" for the root
+     * @returns Owning link to the new node
+     */
+    NodePtr createNode(const T &value, Node *parent);
+
+    /*
+     * @brief Destroys all nodes of the subtree (Non-recursive function)
+     * @param node owning link to the subtree, it is "nullptr" after the call
+     */
+    static void destroyTree(NodePtr &node) noexcept;
+
+    /*
+     * @brief Makes a deep copy of the subtree (Non-recursive function)
+     * @param node subtree to copy
+     * @returns Owning link to the copy
+     */
+    NodePtr copyTree(const Node *node);
+
+    /// Adds 'leftSpineShift' to the left sizes of the nodes on the left spine and resets it
+    void applyLeftSpineShift() noexcept;
+
+    /// Subtrees smaller than this are built on the current thread
+    static constexpr size_t kParallelGrain{1UL << 15};
 
-    /// For multiple use 'certainNode(void)' method
-    static size_t counter;
+    /*
+     * @brief Builds perfectly balanced subtree from sorted values, middle value is the root (Non-recursive function)
+     * @param first iterator on the first of 'count' values in ascending order
+     * @param count count of values
+     * @returns Owning link to the subtree
+     */
+    template <typename RandomIt>
+    NodePtr buildTree(RandomIt first, size_t count);
+
+    /*
+     * @brief Builds perfectly balanced subtree from sorted values. Left subtrees of the top levels are built
+     * on separate threads while the current thread builds right ones (Recursive function, depth is O(log threads))
+     * @param first iterator on the first of 'count' values in ascending order
+     * @param count count of values
+     * @param threads count of threads that build the subtree
+     * @returns Owning link to the subtree
+     */
+    template <typename RandomIt>
+    NodePtr buildTree(RandomIt first, size_t count, size_t threads);
 
 protected:
     /*
@@ -110,10 +191,18 @@ protected:
     std::string T_to_str(const T &value) const noexcept;
 
     /*
+     * @brief Helper method (Non-recursive function)
      * @param node node from which to start count
      * @returns Count of levels (nodes) of binary tree
      */
-    inline size_t count(std::shared_ptr<Node> node) const;
+    static size_t count(const Node *node);
+
+    /*
+     * @brief Helper method (Non-recursive function)
+     * @param node node from which to start count
+     * @returns Max depth of the subtree, 0 if it's empty
+     */
+    static size_t depth(const Node *node);
 
     /*
      * @brief Struct of cells with hidden implementation
@@ -156,35 +245,35 @@ protected:
     std::string transformNumber(int num) const noexcept;
 
     /*
-     * @brief Adding node to the binary tree
+     * @brief Adding node to the binary tree (Non-recursive function)
      * @tparam value which will be added to the node
-     * @param node pointer to 'Node' struct
+     * @param node owning link to the subtree
      */
-    virtual void addNode(const T &value, std::shared_ptr<Node> &node);
+    virtual void addNode(const T &value, NodePtr &node);
 
     /*
-     * @brief Helper method that returns certain node by it's number
+     * @brief Helper method that returns certain node by it's number in preorder (Non-recursive function)
      * @param node pointer to 'Node' struct
-     * @param nodeNumber node number by which search will take place
-     * @returns Certain node by node number
+     * @param nodeNumber node number by which search will take place (starting from 1)
+     * @returns Certain node by node number, "nullptr" if there is no such node
      */
-    std::shared_ptr<Node> certainNode(std::shared_ptr<Node> &node, size_t nodeNumber) const;
+    static Node *certainNode(Node *node, size_t nodeNumber);
 
     /*
-     * @brief Helper method that returns certain node by it's value
+     * @brief Helper method that returns certain node by it's value (Non-recursive function)
      * @param node pointer to 'Node' struct
      * @tparam value value of binary tree by which search will take place
-     * @returns Node if value exists in this binary tree
+     * @returns Node if value exists in this binary tree, otherwise - "nullptr"
      */
-    std::shared_ptr<Node> certainNode(std::shared_ptr<Node> &node, const T &value) const;
+    static Node *certainNode(Node *node, const T &value);
 
     /*
-     * @brief Helper method that returns node number by it's value
+     * @brief Helper method that returns node number by it's value (Non-recursive function)
      * @param node pointer to 'Node' struct
      * @tparam value value of binary tree by which search will take place
-     * @returns Number of node if value exists in this binary tree
+     * @returns Number of node in preorder (starting from 1) if value exists in this binary tree, otherwise - 0
      */
-    size_t searchNodeNumberByValue(std::shared_ptr<Node> &node, const T &value) const;
+    static size_t searchNodeNumberByValue(const Node *node, const T &value);
 
     /*
      * @brief Helper method
@@ -192,22 +281,22 @@ protected:
      * @param nodeNumber node number by which counting of branches will take place
      * @returns Count of branches of certain node
      */
-    size_t branches(std::shared_ptr<Node> &node, size_t nodeNumber) const;
+    static size_t branches(Node *node, size_t nodeNumber);
 
     /*
      * @brief Helper method (Non-recursive function)
      * @param node pointer to 'Node' struct
      * @returns Minimal node in binary tree (lower left element)
-     * starting from the specified number
+     * starting from the specified number, "nullptr" if tree is empty
      */
-    std::shared_ptr<Node> minValue(std::shared_ptr<Node> &node) const;
+    static Node *minValue(Node *node) noexcept;
 
     /*
-     * @brief Helper method (Recursive function)
+     * @brief Helper method (Non-recursive function)
      * @param node pointer to 'Node' struct
-     * @returns Max element in binary tree (lower right element)
+     * @returns Max element in binary tree (lower right element), "nullptr" if tree is empty
      */
-    std::shared_ptr<Node> maxValue(std::shared_ptr<Node> &node) const;
+    static Node *maxValue(Node *node) noexcept;
 
     /*
      * @brief Helper method to find the previous node with specified node number
@@ -215,7 +304,7 @@ protected:
      * @param nodeNumber node number as a pivot
      * @returns Previous node by node number
      */
-    static std::shared_ptr<Node> previousNode(std::shared_ptr<Node> &node, size_t nodeNumber);
+    static Node *previousNode(Node *node, size_t nodeNumber);
 
     /*
      * @brief Helper method to find the next node with specified node number
@@ -223,32 +312,84 @@ protected:
      * @param nodeNumber node number as a pivot
      * @returns Next node by node number
      */
-    static std::shared_ptr<Node> nextNode(std::shared_ptr<Node> &node, size_t nodeNumber);
+    static Node *nextNode(Node *node, size_t nodeNumber);
 
     /*
-     * @brief Helper method that removes node from binary tree by value
-     * @param node pointer to 'Node' struct
+     * @brief Helper method that removes node from binary tree by value (Non-recursive function)
+     * @param node owning link to the subtree
      * @tparam value value of the node which you want to erase from the binary tree
-     * @returns Node which you want to delete
+     * @returns "true" if node was removed
      */
-    std::shared_ptr<Node> removeNodeByValue(std::shared_ptr<Node> node, const T &value);
+    bool removeNodeByValue(NodePtr &node, const T &value);
 
 public:
+    /*
+     * @brief Bidirectional iterator that walks values in ascending order (inorder).
+     * Values can't be changed through it: that would break the order of the tree.
+     * "addNode()" doesn't invalidate iterators, "removeNode()" invalidates all of them
+     */
+    class const_iterator;
+    using iterator = const_iterator;
+
     /// Zero-argument, default ctor
     explicit BinaryTree(void) = default;
 
+    /*
+     * @brief Ctor with allocator
+     * @param alloc allocator for the nodes
+     */
+    explicit BinaryTree(const Allocator &alloc);
+
     /*
      * @brief Default ctor with 1 template parameter
      * @tparam value value which will initialize the binary tree (head node value)
+     * @param alloc allocator for the nodes
+     */
+    explicit BinaryTree(const T &value, const Allocator &alloc = Allocator());
+
+    /*
+     * @brief Ctor from a sorted range, builds perfectly balanced tree in O(n): every node is allocated once,
+     * nothing is searched and nothing is moved
+     * @param first, last range of values in ascending order
+     * @param alloc allocator for the nodes
+     * @throws "std::invalid_argument" if values aren't sorted
+     */
+    template <typename RandomIt,
+              typename Category = typename std::iterator_traits<RandomIt>::iterator_category,
+              typename = std::enable_if_t<std::is_base_of_v<std::random_access_iterator_tag, Category>>>
+    BinaryTree(RandomIt first, RandomIt last, const Allocator &alloc = Allocator());
+
+    /*
+     * @brief Ctor from a sorted range, same as above, but subtrees are built on 'threads' threads.
+     * Allocator has to be thread-safe ("std::allocator" is, "NodePoolAllocator" isn't)
+     * @param first, last range of values in ascending order
+     * @param threads count of threads, 1 - build on the current thread only
+     * @param alloc allocator for the nodes
+     * @throws "std::invalid_argument" if values aren't sorted
      */
-    explicit BinaryTree(const T &value);
+    template <typename RandomIt,
+              typename Category = typename std::iterator_traits<RandomIt>::iterator_category,
+              typename = std::enable_if_t<std::is_base_of_v<std::random_access_iterator_tag, Category>>>
+    BinaryTree(RandomIt first, RandomIt last, size_t threads, const Allocator &alloc = Allocator());
 
-    /// Ctor with main param (it is also copy ctor)
+    /// Ctor with main param (it is also copy ctor), makes a deep copy of the tree
     explicit BinaryTree(const BinaryTree *&);
 
-    /// Assignment operator
+    /// Assignment operator, makes a deep copy of the tree
     BinaryTree &operator=(const BinaryTree *&);
 
+    /// Copy ctor, makes a deep copy of the tree
+    BinaryTree(const BinaryTree &);
+
+    /// Move ctor, leaves moved tree empty
+    BinaryTree(BinaryTree &&) noexcept;
+
+    /// Copy assignment operator, makes a deep copy of the tree
+    BinaryTree &operator=(const BinaryTree &);
+
+    /// Move assignment operator, leaves moved tree empty
+    BinaryTree &operator=(BinaryTree &&) noexcept;
+
     /// Getter for max depth
     inline size_t getMaxDepth(void) const;
 
@@ -272,6 +413,61 @@ public:
     /// Printing count of nodes
     void printCountOfNodes(void) const;
 
+    /// Returns count of nodes, O(1)
+    constexpr size_t size(void) const noexcept { return nodesCount; }
+
+    /*
+     * @brief Searching k-th smallest value (Non-recursive function)
+     * @param k position of the value in sorted order (starting from 0)
+     * @returns Value with 'k' values lower than or equal to it before it
+     * @throws "std::out_of_range" if 'k' is not lower than count of nodes
+     */
+    const T &select(size_t k) const;
+
+    /*
+     * @brief Counting values lower than specified one (Non-recursive function)
+     * @tparam value value to search, it may be absent in the binary tree
+     * @returns Count of values lower than 'value', i.e. position of the first 'value' in sorted order
+     */
+    size_t rank(const T &value) const;
+
+    /// Returns iterator on the min value, O(depth)
+    const_iterator begin(void) const noexcept;
+
+    /// Returns iterator past the max value
+    const_iterator end(void) const noexcept;
+
+    /*
+     * @brief Searching the first value that is not lower than specified one (Non-recursive function)
+     * @tparam value value to search, it may be absent in the binary tree
+     * @returns Iterator on the found value, "end()" if all values are lower than 'value'
+     */
+    const_iterator lower_bound(const T &value) const;
+
+    /*
+     * @brief Searching the first value that is greater than specified one (Non-recursive function)
+     * @tparam value value to search, it may be absent in the binary tree
+     * @returns Iterator on the found value, "end()" if there are no values greater than 'value'
+     */
+    const_iterator upper_bound(const T &value) const;
+
+    /*
+     * @brief Calls 'fn' for every value in [lo, hi) in ascending order. Walk starts from "lower_bound(lo)"
+     * and stops at the first value that is not lower than 'hi', so subtrees out of the range aren't visited:
+     * it takes O(depth + count of values in the range)
+     * @tparam lo lower bound of the range (included)
+     * @tparam hi upper bound of the range (excluded)
+     * @param fn function that takes 'const T &'
+     */
+    template <typename Fn>
+    void for_each_in_range(const T &lo, const T &hi, Fn &&fn) const;
+
+    /*
+     * @brief Makes immutable copy of the binary tree stored in one array, which is searched faster (Non-recursive function)
+     * @returns Balanced tree with all values of this binary tree
+     */
+    FrozenBinaryTree<T> freeze(void) const;
+
     /*
      * @brief Printing branches of certain node (keep in mind that the countdown starts from 0)
      * @param nodeNumber node number from which will start printing
@@ -279,13 +475,15 @@ public:
     void printBranchesOfCertainNode(size_t nodeNumber);
 
     /*
-     * @brief Printing value of certain node. Searching by node number
+     * @brief Printing value of certain node. Searching by node number.
+     * Nodes are numbered in preorder, so the search walks the tree - O(n). See "select()" for the sorted order
      * @param nodeNumber node number that specifes some value
      */
     void printValueByNode(size_t nodeNumber);
 
     /*
-     * @brief Printing node number which found by searching by value
+     * @brief Printing node number which found by searching by value.
+     * Nodes are numbered in preorder, so the search walks the tree - O(n). See "rank()" for the sorted order
      * @tparam value value to search node number
      */
     void printNodeNumberByValue(const T &value);
@@ -302,8 +500,8 @@ public:
      */
     void removeNode(const T &value);
 
-    /// Virtual dtor
-    virtual ~BinaryTree(void) = default;
+    /// Virtual dtor, destroys nodes without recursion
+    virtual ~BinaryTree(void);
 };
 
 #endif // BINTREE_HPP
@@ -2,9 +2,14 @@
 #define BINTREE_IMPL_HPP
 
 #include <algorithm>
+#include <exception>
 #include <sstream>
+#include <thread>
+#include <tuple>
+#include <utility>
 
 #include "bintree.hpp"
+#include "frozen_bintree_impl.hpp"
 
 /*
  * @brief Struct 'Node' describes node of the binary tree that has two branches
@@ -14,25 +19,112 @@
 template <typename T, typename Allocator>
 struct BinaryTree<T, Allocator>::Node
 {
-    T value{""};
+    T value;
 
     // Points on left root of tree
-    std::shared_ptr<Node> leftRoot;
+    NodePtr leftRoot;
     // Points on right root of tree
-    std::shared_ptr<Node> rightRoot;
+    NodePtr rightRoot;
 
-    explicit Node() : leftRoot(nullptr), rightRoot(nullptr) {}
-    explicit Node(const T &newValue) : value(std::move(newValue)), leftRoot(nullptr), rightRoot(nullptr) {}
+    // Points on the node that owns this one, "nullptr" for the root
+    Node *parent;
 
-    // Returns max depth from two roots
-    size_t max() const noexcept
+    // Count of nodes in the left subtree (shifted on the left spine, see 'leftSpineShift')
+    size_t leftSize{};
+
+    explicit Node(const T &newValue, Node *newParent, const NodeAllocator &alloc)
+        : value(newValue), leftRoot(nullptr, NodeDeleter{alloc}), rightRoot(nullptr, NodeDeleter{alloc}),
+          parent(newParent) {}
+};
+
+template <typename T, typename Allocator>
+void BinaryTree<T, Allocator>::NodeDeleter::operator()(Node *node) noexcept
+{
+    NodeTraits::destroy(alloc, node);
+    NodeTraits::deallocate(alloc, node, 1);
+}
+
+template <typename T, typename Allocator>
+class BinaryTree<T, Allocator>::const_iterator
+{
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = const T &;
+
+    const_iterator() = default;
+
+    reference operator*() const noexcept { return node->value; }
+    pointer operator->() const noexcept { return &node->value; }
+
+    // Next value: min of the right subtree, otherwise the first ancestor that has this node in its left subtree
+    const_iterator &operator++() noexcept
+    {
+        if (node->rightRoot)
+            node = minValue(node->rightRoot.get());
+        else
+        {
+            const Node *child{node};
+            node = node->parent;
+            while (node not_eq nullptr and child == node->rightRoot.get())
+            {
+                child = node;
+                node = node->parent;
+            }
+        }
+        return *this;
+    }
+
+    // Previous value: max of the left subtree, otherwise the first ancestor that has this node in its right subtree.
+    // Previous of "end()" is the max value of the tree
+    const_iterator &operator--() noexcept
+    {
+        if (node == nullptr)
+            node = maxValue(tree->root.get());
+        else if (node->leftRoot)
+            node = maxValue(node->leftRoot.get());
+        else
+        {
+            const Node *child{node};
+            node = node->parent;
+            while (node not_eq nullptr and child == node->leftRoot.get())
+            {
+                child = node;
+                node = node->parent;
+            }
+        }
+        return *this;
+    }
+
+    const_iterator operator++(int) noexcept
     {
-        const size_t left_depth{leftRoot ? leftRoot->max() : 0};
-        const size_t right_depth{rightRoot ? rightRoot->max() : 0};
-        return (left_depth > right_depth ? left_depth : right_depth) + 1;
+        const_iterator previous{*this};
+        ++*this;
+        return previous;
     }
 
-    virtual ~Node() = default;
+    const_iterator operator--(int) noexcept
+    {
+        const_iterator previous{*this};
+        --*this;
+        return previous;
+    }
+
+    bool operator==(const const_iterator &other) const noexcept { return node == other.node; }
+    bool operator!=(const const_iterator &other) const noexcept { return node not_eq other.node; }
+
+private:
+    friend class BinaryTree;
+
+    const_iterator(const Node *newNode, const BinaryTree *newTree) noexcept : node(newNode), tree(newTree) {}
+
+    // Current node, "nullptr" for "end()"
+    const Node *node{};
+
+    // Tree of the node, it is needed to step back from "end()"
+    const BinaryTree *tree{};
 };
 
 template <typename T, typename Allocator>
@@ -47,7 +139,178 @@ struct BinaryTree<T, Allocator>::cell_display
 };
 
 template <typename T, typename Allocator>
-size_t BinaryTree<T, Allocator>::counter = 0;
+typename BinaryTree<T, Allocator>::NodePtr BinaryTree<T, Allocator>::createNode(const T &value, Node *parent)
+{
+    Node *node{NodeTraits::allocate(alloc, 1)};
+    try
+    {
+        NodeTraits::construct(alloc, node, value, parent, alloc);
+    }
+    catch (...)
+    {
+        NodeTraits::deallocate(alloc, node, 1);
+        throw;
+    }
+    return NodePtr(node, NodeDeleter{alloc});
+}
+
+template <typename T, typename Allocator>
+void BinaryTree<T, Allocator>::destroyTree(NodePtr &node) noexcept
+{
+    // Rotating left children up turns the tree into a right-leaning list, then nodes are
+    // destroyed one by one, each of them has no children at that moment -> no recursion
+    while (node not_eq nullptr)
+    {
+        if (node->leftRoot not_eq nullptr)
+        {
+            NodePtr left{std::move(node->leftRoot)};
+            node->leftRoot = std::move(left->rightRoot);
+            left->rightRoot = std::move(node);
+            node = std::move(left);
+        }
+        else
+        {
+            // Child is taken out first: move assignment would read its deleter after the parent is destroyed
+            NodePtr right{std::move(node->rightRoot)};
+            node = std::move(right);
+        }
+    }
+}
+
+template <typename T, typename Allocator>
+typename BinaryTree<T, Allocator>::NodePtr BinaryTree<T, Allocator>::copyTree(const Node *node)
+{
+    NodePtr copy{nullptr, NodeDeleter{alloc}};
+    if (node == nullptr)
+        return copy;
+
+    // Source node, link in the copy that has to point on its copy and parent of the copy
+    std::vector<std::tuple<const Node *, NodePtr *, Node *>> stack{{node, &copy, nullptr}};
+    try
+    {
+        while (not stack.empty())
+        {
+            auto [source, link, parent]{stack.back()};
+            stack.pop_back();
+
+            *link = createNode(source->value, parent);
+            (*link)->leftSize = source->leftSize;
+            if (source->rightRoot)
+                stack.emplace_back(source->rightRoot.get(), &(*link)->rightRoot, link->get());
+            if (source->leftRoot)
+                stack.emplace_back(source->leftRoot.get(), &(*link)->leftRoot, link->get());
+        }
+    }
+    catch (...)
+    {
+        destroyTree(copy);
+        throw;
+    }
+    return copy;
+}
+
+template <typename T, typename Allocator>
+void BinaryTree<T, Allocator>::applyLeftSpineShift() noexcept
+{
+    for (Node *node{root.get()}; node not_eq nullptr; node = node->leftRoot.get())
+        node->leftSize += leftSpineShift;
+    leftSpineShift = 0;
+}
+
+template <typename T, typename Allocator>
+template <typename RandomIt>
+typename BinaryTree<T, Allocator>::NodePtr BinaryTree<T, Allocator>::buildTree(RandomIt first, size_t count)
+{
+    using Difference = typename std::iterator_traits<RandomIt>::difference_type;
+
+    NodePtr subtree{nullptr, NodeDeleter{alloc}};
+    // Ranges of values, links that have to own the middle value of the range and parents of the middle values
+    struct Range
+    {
+        size_t begin, count;
+        NodePtr *link;
+        Node *parent;
+    };
+    std::vector<Range> stack;
+    if (count not_eq 0)
+        stack.push_back({0, count, &subtree, nullptr});
+    try
+    {
+        while (not stack.empty())
+        {
+            const Range range{stack.back()};
+            stack.pop_back();
+
+            const size_t half{range.count / 2UL};
+            *range.link = createNode(first[static_cast<Difference>(range.begin + half)], range.parent);
+            Node *middle{range.link->get()};
+            middle->leftSize = half;
+            if (range.count - half - 1UL not_eq 0)
+                stack.push_back({range.begin + half + 1UL, range.count - half - 1UL, &middle->rightRoot, middle});
+            if (half not_eq 0)
+                stack.push_back({range.begin, half, &middle->leftRoot, middle});
+        }
+    }
+    catch (...)
+    {
+        destroyTree(subtree);
+        throw;
+    }
+    return subtree;
+}
+
+template <typename T, typename Allocator>
+template <typename RandomIt>
+typename BinaryTree<T, Allocator>::NodePtr BinaryTree<T, Allocator>::buildTree(RandomIt first, size_t count,
+                                                                               size_t threads)
+{
+    using Difference = typename std::iterator_traits<RandomIt>::difference_type;
+
+    if (threads < 2UL or count < kParallelGrain)
+        return buildTree(first, count);
+
+    const size_t half{count / 2UL};
+    NodePtr subtree{createNode(first[static_cast<Difference>(half)], nullptr)};
+    subtree->leftSize = half;
+
+    NodePtr left{nullptr, NodeDeleter{alloc}};
+    std::exception_ptr leftError;
+    std::thread leftBuilder([this, &left, &leftError, first, half, threads]
+                            {
+                                try
+                                {
+                                    left = buildTree(first, half, threads / 2UL);
+                                }
+                                catch (...)
+                                {
+                                    leftError = std::current_exception();
+                                } });
+    try
+    {
+        subtree->rightRoot = buildTree(first + static_cast<Difference>(half + 1UL), count - half - 1UL,
+                                       threads - threads / 2UL);
+        if (subtree->rightRoot)
+            subtree->rightRoot->parent = subtree.get();
+    }
+    catch (...)
+    {
+        leftBuilder.join();
+        destroyTree(left);
+        destroyTree(subtree);
+        throw;
+    }
+    leftBuilder.join();
+
+    if (leftError)
+    {
+        destroyTree(subtree);
+        std::rethrow_exception(leftError);
+    }
+    subtree->leftRoot = std::move(left);
+    if (subtree->leftRoot)
+        subtree->leftRoot->parent = subtree.get();
+    return subtree;
+}
 
 template <typename T, typename Allocator>
 std::string BinaryTree<T, Allocator>::T_to_str(const T &value) const noexcept
@@ -58,9 +321,49 @@ std::string BinaryTree<T, Allocator>::T_to_str(const T &value) const noexcept
 }
 
 template <typename T, typename Allocator>
-size_t BinaryTree<T, Allocator>::count(std::shared_ptr<BinaryTree<T, Allocator>::Node> node) const
+size_t BinaryTree<T, Allocator>::count(const Node *node)
+{
+    size_t nodes{};
+    std::vector<const Node *> stack;
+    while (node not_eq nullptr or not stack.empty())
+    {
+        if (node == nullptr)
+        {
+            node = stack.back();
+            stack.pop_back();
+        }
+        ++nodes;
+        // Left branch is walked right away, right one - later
+        if (node->rightRoot)
+            stack.push_back(node->rightRoot.get());
+        node = node->leftRoot.get();
+    }
+    return nodes;
+}
+
+template <typename T, typename Allocator>
+size_t BinaryTree<T, Allocator>::depth(const Node *node)
 {
-    return (node == nullptr) ? 0 : (1U + count(node->leftRoot) + count(node->rightRoot));
+    if (node == nullptr)
+        return 0;
+
+    // Level-by-level walk: count of levels is the depth
+    size_t levels{};
+    std::vector<const Node *> level{node}, next;
+    while (not level.empty())
+    {
+        ++levels;
+        next.clear();
+        for (const Node *pnode : level)
+        {
+            if (pnode->leftRoot)
+                next.push_back(pnode->leftRoot.get());
+            if (pnode->rightRoot)
+                next.push_back(pnode->rightRoot.get());
+        }
+        level.swap(next);
+    }
+    return levels;
 }
 
 template <typename T, typename Allocator>
@@ -68,14 +371,14 @@ std::vector<std::vector<struct BinaryTree<T, Allocator>::cell_display>> BinaryTr
     const noexcept
 {
     // Build a std::vector of std::vectors of Node pointers
-    std::vector<std::shared_ptr<Node>> travers{};
-    std::vector<std::vector<std::shared_ptr<Node>>> rows{};
+    std::vector<const Node *> travers{};
+    std::vector<std::vector<const Node *>> rows{};
 
     if (root == nullptr)
         return std::vector<std::vector<struct cell_display>>();
 
-    std::shared_ptr<Node> pNode(root);
-    const size_t maxDepth{root.get()->max()};
+    const Node *pNode{root.get()};
+    const size_t maxDepth{depth(root.get())};
 
     rows.resize(maxDepth);
     size_t depth{0};
@@ -99,7 +402,7 @@ std::vector<std::vector<struct BinaryTree<T, Allocator>::cell_display>> BinaryTr
             rows.at(depth).push_back(pNode);
             travers.push_back(pNode);
             if (pNode != nullptr)
-                pNode = pNode->leftRoot;
+                pNode = pNode->leftRoot.get();
             ++depth;
             continue;
         }
@@ -109,7 +412,7 @@ std::vector<std::vector<struct BinaryTree<T, Allocator>::cell_display>> BinaryTr
         {
             pNode = travers.back();
             if (pNode)
-                pNode = pNode->rightRoot;
+                pNode = pNode->rightRoot.get();
             ++depth;
             continue;
         }
@@ -307,242 +610,281 @@ std::string BinaryTree<T, Allocator>::transformNumber(int num) const noexcept
 }
 
 template <typename T, typename Allocator>
-void BinaryTree<T, Allocator>::addNode(const T &value, std::shared_ptr<Node> &node)
+void BinaryTree<T, Allocator>::addNode(const T &value, NodePtr &node)
 {
-    if (node == nullptr)
-        node = std::make_shared<Node>(value);
-    else
+    NodePtr *link{&node};
+    Node *parent{};
+    bool onLeftSpine{&node == &root};
+    while (*link not_eq nullptr)
     {
-        if (value < node->value)
-        {
-            if (node->leftRoot not_eq nullptr)
-                addNode(value, node->leftRoot);
-            else
-                node->leftRoot = std::make_shared<Node>(value);
-        }
-        else if (value >= node->value)
+        parent = link->get();
+        if (value < (*link)->value)
+            link = &(*link)->leftRoot;
+        else
         {
-            if (node->rightRoot not_eq nullptr)
-                addNode(value, node->rightRoot);
-            else
-                node->rightRoot = std::make_shared<Node>(value);
+            onLeftSpine = false;
+            link = &(*link)->rightRoot;
         }
     }
+    *link = createNode(value, parent);
+    // Real left size of the new node is 0
+    if (onLeftSpine)
+        (*link)->leftSize = 0UL - leftSpineShift;
+
+    // Sizes are updated only when the node exists, so a throwing copy of 'value' leaves them as they were.
+    // Parents lead back along the search path, every node it went left on gets one more node on the left
+    for (Node *child{link->get()}; child not_eq node.get(); child = child->parent)
+        if (child->parent->leftRoot.get() == child)
+            ++child->parent->leftSize;
+    ++nodesCount;
 }
 
 template <typename T, typename Allocator>
-std::shared_ptr<struct BinaryTree<T, Allocator>::Node> BinaryTree<T, Allocator>::certainNode(std::shared_ptr<Node> &node, size_t nodeNumber) const
+typename BinaryTree<T, Allocator>::Node *BinaryTree<T, Allocator>::certainNode(Node *node, size_t nodeNumber)
 {
-    static std::shared_ptr<Node> pnode;
-
-    if (node == nullptr)
-        return nullptr;
-    else
+    size_t number{};
+    std::vector<Node *> stack;
+    while (node not_eq nullptr or not stack.empty())
     {
-        counter++;
-
-        if (counter == nodeNumber)
-            pnode = node;
-
-        certainNode(node->leftRoot, nodeNumber);
-        certainNode(node->rightRoot, nodeNumber);
-
-        return pnode;
+        if (node == nullptr)
+        {
+            node = stack.back();
+            stack.pop_back();
+        }
+        if (++number == nodeNumber)
+            return node;
+        if (node->rightRoot)
+            stack.push_back(node->rightRoot.get());
+        node = node->leftRoot.get();
     }
+    return nullptr;
 }
 
 template <typename T, typename Allocator>
-std::shared_ptr<struct BinaryTree<T, Allocator>::Node>
-BinaryTree<T, Allocator>::certainNode(std::shared_ptr<Node> &node, const T &value) const
+typename BinaryTree<T, Allocator>::Node *BinaryTree<T, Allocator>::certainNode(Node *node, const T &value)
 {
-    static std::shared_ptr<Node> pnode;
+    while (node not_eq nullptr and not(value == node->value))
+        node = value < node->value ? node->leftRoot.get() : node->rightRoot.get();
+    return node;
+}
 
-    if (node == nullptr)
-        return nullptr;
-    else
+template <typename T, typename Allocator>
+size_t BinaryTree<T, Allocator>::searchNodeNumberByValue(const Node *node, const T &value)
+{
+    size_t number{};
+    std::vector<const Node *> stack;
+    while (node not_eq nullptr or not stack.empty())
     {
+        if (node == nullptr)
+        {
+            node = stack.back();
+            stack.pop_back();
+        }
+        ++number;
         if (value == node->value)
-            pnode = node;
-
-        certainNode(node->leftRoot, value);
-        certainNode(node->rightRoot, value);
-
-        return pnode;
+            return number;
+        if (node->rightRoot)
+            stack.push_back(node->rightRoot.get());
+        node = node->leftRoot.get();
     }
+    return 0;
 }
 
 template <typename T, typename Allocator>
-size_t
-BinaryTree<T, Allocator>::searchNodeNumberByValue(std::shared_ptr<Node> &node, const T &value) const
+size_t BinaryTree<T, Allocator>::branches(Node *node, size_t nodeNumber)
 {
-    static size_t nodeNumber{};
-
-    if (node == nullptr)
+    const Node *pNode{certainNode(node, nodeNumber)};
+    if (pNode == nullptr)
         return 0;
-    else
-    {
-        counter++;
-        if (value == node->value)
-            nodeNumber = counter;
-
-        searchNodeNumberByValue(node->leftRoot, value);
-        searchNodeNumberByValue(node->rightRoot, value);
-
-        return nodeNumber;
-    }
+    return (pNode->leftRoot not_eq nullptr) + (pNode->rightRoot not_eq nullptr);
 }
 
 template <typename T, typename Allocator>
-size_t BinaryTree<T, Allocator>::branches(std::shared_ptr<Node> &node, size_t nodeNumber) const
+typename BinaryTree<T, Allocator>::Node *BinaryTree<T, Allocator>::minValue(Node *node) noexcept
 {
-    size_t countOfBranches{};
-
-    if (counter not_eq 0)
-        counter = 0;
-
-    static std::shared_ptr<Node> pNode{certainNode(node, nodeNumber)};
-
-    if ((pNode->leftRoot not_eq nullptr) and (pNode->rightRoot not_eq nullptr))
-        countOfBranches = 2;
-    else if ((pNode->leftRoot not_eq nullptr) or (pNode->rightRoot not_eq nullptr))
-        countOfBranches = 1;
-    else
-        countOfBranches = 0;
+    if (node == nullptr)
+        return nullptr;
+    while (node->leftRoot not_eq nullptr)
+        node = node->leftRoot.get();
+    return node;
+}
 
-    return countOfBranches;
+template <typename T, typename Allocator>
+typename BinaryTree<T, Allocator>::Node *BinaryTree<T, Allocator>::maxValue(Node *node) noexcept
+{
+    if (node == nullptr)
+        return nullptr;
+    while (node->rightRoot not_eq nullptr)
+        node = node->rightRoot.get();
+    return node;
 }
 
 template <typename T, typename Allocator>
-std::shared_ptr<struct BinaryTree<T, Allocator>::Node> BinaryTree<T, Allocator>::minValue(std::shared_ptr<Node> &node) const
+typename BinaryTree<T, Allocator>::Node *BinaryTree<T, Allocator>::previousNode(Node *node, size_t nodeNumber)
 {
-    std::shared_ptr<Node> pnode{node};
-    while (pnode->leftRoot not_eq nullptr)
-        pnode = pnode->leftRoot;
-    return pnode;
+    return nodeNumber > 1 ? certainNode(node, nodeNumber - 1) : nullptr;
 }
 
 template <typename T, typename Allocator>
-std::shared_ptr<struct BinaryTree<T, Allocator>::Node>
-BinaryTree<T, Allocator>::maxValue(std::shared_ptr<Node> &node) const
+typename BinaryTree<T, Allocator>::Node *BinaryTree<T, Allocator>::nextNode(Node *node, size_t nodeNumber)
 {
-    // Tree is empty
-    if (node == nullptr)
-        return nullptr;
-    // Tree is not empty
-    else
-        return (node->rightRoot == nullptr) ? node : maxValue(node->rightRoot);
+    return certainNode(node, nodeNumber + 1);
 }
 
 template <typename T, typename Allocator>
-std::shared_ptr<struct BinaryTree<T, Allocator>::Node>
-BinaryTree<T, Allocator>::previousNode(std::shared_ptr<Node> &node, size_t nodeNumber)
+bool BinaryTree<T, Allocator>::removeNodeByValue(NodePtr &node, const T &value)
 {
-    static std::shared_ptr<Node> pprev;
+    // Looking for the link that owns node with specified value
+    NodePtr *link{&node};
+    while (*link not_eq nullptr and not(value == (*link)->value))
+        link = value < (*link)->value ? &(*link)->leftRoot : &(*link)->rightRoot;
+
+    // There is no such value
+    if (*link == nullptr)
+        return false;
+
+    // Removed node leaves left subtrees of the nodes where the search went left
+    applyLeftSpineShift();
+    for (Node *pnode{node.get()}; pnode not_eq link->get();)
+    {
+        if (value < pnode->value)
+        {
+            --pnode->leftSize;
+            pnode = pnode->leftRoot.get();
+        }
+        else
+            pnode = pnode->rightRoot.get();
+    }
+    --nodesCount;
 
-    if (node == nullptr)
-        return nullptr;
+    Node &found{**link};
+    // Case 1 and 2: Node has no child or has only 1 child, it takes the place of the node
+    if (found.leftRoot == nullptr or found.rightRoot == nullptr)
+    {
+        NodePtr child{std::move(found.leftRoot ? found.leftRoot : found.rightRoot)};
+        if (child)
+            child->parent = found.parent;
+        *link = std::move(child);
+    }
     else
     {
-        counter++;
-
-        if (counter == (nodeNumber - 1))
-            pprev = node;
-
-        previousNode(node->leftRoot, nodeNumber);
-        previousNode(node->rightRoot, nodeNumber);
-
-        return pprev;
+        // Case 3: Node has 2 children
+        // Smallest in the right subtree
+        NodePtr *successor{&found.rightRoot};
+        while ((*successor)->leftRoot not_eq nullptr)
+        {
+            --(*successor)->leftSize;
+            successor = &(*successor)->leftRoot;
+        }
+        // Move the inorder successor's data to this node and unlink the successor
+        found.value = std::move((*successor)->value);
+        NodePtr right{std::move((*successor)->rightRoot)};
+        if (right)
+            right->parent = (*successor)->parent;
+        *successor = std::move(right);
     }
+    return true;
 }
 
 template <typename T, typename Allocator>
-std::shared_ptr<struct BinaryTree<T, Allocator>::Node>
-BinaryTree<T, Allocator>::nextNode(std::shared_ptr<Node> &node, size_t nodeNumber)
-{
-    static std::shared_ptr<Node> pnext;
+BinaryTree<T, Allocator>::BinaryTree(const Allocator &alloc)
+    : root(nullptr, NodeDeleter{NodeAllocator(alloc)}), alloc(alloc) {}
 
-    if (node == nullptr)
-        return nullptr;
-    else
-    {
-        counter++;
+template <typename T, typename Allocator>
+BinaryTree<T, Allocator>::BinaryTree(const T &value, const Allocator &alloc)
+    : root(nullptr, NodeDeleter{NodeAllocator(alloc)}), alloc(alloc)
+{
+    root = createNode(value, nullptr);
+    nodesCount = 1;
+}
 
-        if (counter == (nodeNumber + 1))
-            pnext = node;
+template <typename T, typename Allocator>
+template <typename RandomIt, typename Category, typename>
+BinaryTree<T, Allocator>::BinaryTree(RandomIt first, RandomIt last, const Allocator &alloc)
+    : BinaryTree(first, last, 1UL, alloc) {}
 
-        nextNode(node->leftRoot, nodeNumber);
-        nextNode(node->rightRoot, nodeNumber);
+template <typename T, typename Allocator>
+template <typename RandomIt, typename Category, typename>
+BinaryTree<T, Allocator>::BinaryTree(RandomIt first, RandomIt last, size_t threads, const Allocator &alloc)
+    : root(nullptr, NodeDeleter{NodeAllocator(alloc)}), alloc(alloc)
+{
+    if (not std::is_sorted(first, last))
+        throw std::invalid_argument("Exception: std::invalid_argument: values have to be sorted in ascending order");
 
-        return pnext;
-    }
+    const size_t count{static_cast<size_t>(last - first)};
+    root = buildTree(first, count, threads);
+    nodesCount = count;
 }
 
 template <typename T, typename Allocator>
-std::shared_ptr<struct BinaryTree<T, Allocator>::Node>
-BinaryTree<T, Allocator>::removeNodeByValue(std::shared_ptr<Node> node, const T &value)
+BinaryTree<T, Allocator>::BinaryTree(const BinaryTree *&binary_tree) : BinaryTree(*binary_tree) {}
+
+template <typename T, typename Allocator>
+BinaryTree<T, Allocator> &BinaryTree<T, Allocator>::operator=(const BinaryTree *&binary_tree)
 {
-    // If tree is emplty -> return null
-    if (node == nullptr)
-        return nullptr;
-    else
-    {
-        // If node value which we want to delete is smaller than the root's value, then it lies in left subtree
-        if (value < node->value)
-            node->leftRoot = removeNodeByValue(node->leftRoot, value);
-        // If node value which we want to delete is greater than the root's value, then it lies in left subtree
-        else if (value > node->value)
-            node->rightRoot = removeNodeByValue(node->rightRoot, value);
-        // If node value equals specified value -> found node which we want to delete
-        else
-        {
-            // Case 1: Node has no child or has only 1 (left) child
-            if (node->rightRoot == nullptr)
-                return node->leftRoot;
-            // Case 2: Node has no child or has only 1 (right) child
-            else if (node->leftRoot == nullptr)
-                return node->rightRoot;
-            else
-            {
-                // Case 3: Node has 2 children
-                // Smallest in the right subtree
-                std::shared_ptr<Node> ptmp{minValue(node->rightRoot)};
-                // Copy the inorder successor's data to this node
-                node->value = ptmp->value;
-                // Delete the inorder successor
-                node->rightRoot = removeNodeByValue(node->rightRoot, ptmp->value);
-            }
-        }
-    }
-    return node;
+    return *this = *binary_tree;
 }
 
 template <typename T, typename Allocator>
-BinaryTree<T, Allocator>::BinaryTree(const T &value)
+BinaryTree<T, Allocator>::BinaryTree(const BinaryTree &binary_tree)
+    : root(nullptr, NodeDeleter{binary_tree.alloc}),
+      alloc(NodeTraits::select_on_container_copy_construction(binary_tree.alloc)),
+      nodesCount(binary_tree.nodesCount), leftSpineShift(binary_tree.leftSpineShift)
 {
-    root = std::make_shared<Node>(value);
-    root->value = value;
+    root = copyTree(binary_tree.root.get());
 }
 
 template <typename T, typename Allocator>
-BinaryTree<T, Allocator>::BinaryTree(const BinaryTree *&binary_tree)
+BinaryTree<T, Allocator>::BinaryTree(BinaryTree &&binary_tree) noexcept
+    : root(std::move(binary_tree.root)), alloc(binary_tree.alloc),
+      leftmost(std::exchange(binary_tree.leftmost, nullptr)), rightmost(std::exchange(binary_tree.rightmost, nullptr)),
+      nodesCount(std::exchange(binary_tree.nodesCount, 0)), leftSpineShift(std::exchange(binary_tree.leftSpineShift, 0)) {}
+
+template <typename T, typename Allocator>
+BinaryTree<T, Allocator> &BinaryTree<T, Allocator>::operator=(const BinaryTree &binary_tree)
 {
-    root = binary_tree->root;
+    // Checking self-assignment
+    if (this == &binary_tree)
+        return *this;
+
+    destroyTree(root);
+    if constexpr (NodeTraits::propagate_on_container_copy_assignment::value)
+        alloc = binary_tree.alloc;
+    nodesCount = leftSpineShift = 0;
+    root = copyTree(binary_tree.root.get());
+    leftmost = rightmost = nullptr;
+    nodesCount = binary_tree.nodesCount;
+    leftSpineShift = binary_tree.leftSpineShift;
+
+    return *this;
 }
 
 template <typename T, typename Allocator>
-BinaryTree<T, Allocator> &BinaryTree<T, Allocator>::operator=(const BinaryTree *&binary_tree)
+BinaryTree<T, Allocator> &BinaryTree<T, Allocator>::operator=(BinaryTree &&binary_tree) noexcept
 {
     // Checking self-assignment
-    if (this == binary_tree)
+    if (this == &binary_tree)
         return *this;
 
-    root = binary_tree->root;
+    destroyTree(root);
+    // Nodes are returned to the allocator stored in their links, so they can be adopted
+    // even if allocators of the trees differ
+    root = std::move(binary_tree.root);
+    if constexpr (NodeTraits::propagate_on_container_move_assignment::value)
+        alloc = binary_tree.alloc;
+    leftmost = std::exchange(binary_tree.leftmost, nullptr);
+    rightmost = std::exchange(binary_tree.rightmost, nullptr);
+    nodesCount = std::exchange(binary_tree.nodesCount, 0);
+    leftSpineShift = std::exchange(binary_tree.leftSpineShift, 0);
 
     return *this;
 }
 
 template <typename T, typename Allocator>
-inline size_t BinaryTree<T, Allocator>::getMaxDepth() const { return root ? root->max() : 0; }
+BinaryTree<T, Allocator>::~BinaryTree() { destroyTree(root); }
+
+template <typename T, typename Allocator>
+inline size_t BinaryTree<T, Allocator>::getMaxDepth() const { return depth(root.get()); }
 
 template <typename T, typename Allocator>
 void BinaryTree<T, Allocator>::show() const
@@ -572,30 +914,181 @@ void BinaryTree<T, Allocator>::show() const
 template <typename T, typename Allocator>
 void BinaryTree<T, Allocator>::addNode(const T &value)
 {
-    addNode(value, root);
+    if (root == nullptr)
+    {
+        root = createNode(value, nullptr);
+        leftmost = rightmost = root.get();
+        nodesCount = 1;
+        leftSpineShift = 0;
+        return;
+    }
+
+    // Extreme nodes are forgotten after removal, finding them again costs one walk
+    if (rightmost == nullptr)
+        rightmost = maxValue(root.get());
+    if (leftmost == nullptr)
+        leftmost = minValue(root.get());
+
+    // New max value: search would go right on every node of the right spine and stop at 'rightmost'
+    if (not(value < rightmost->value))
+    {
+        // Left sizes don't change: new node is in the right subtrees only
+        rightmost->rightRoot = createNode(value, rightmost);
+        rightmost = rightmost->rightRoot.get();
+        ++nodesCount;
+    }
+    // New min value: search would go left on every node of the left spine and stop at 'leftmost'
+    else if (value < leftmost->value)
+    {
+        // Left size of every node on the spine grows by 1, real left size of the new node is 0
+        leftmost->leftRoot = createNode(value, leftmost);
+        leftmost = leftmost->leftRoot.get();
+        leftmost->leftSize = 0UL - ++leftSpineShift;
+        ++nodesCount;
+    }
+    else
+        addNode(value, root);
 }
 
 template <typename T, typename Allocator>
 template <typename... Args>
 void BinaryTree<T, Allocator>::addNodes(const T &value, Args &...args)
 {
-    addNode(value, root);
-    (addNode(args, root), ...);
+    addNode(value);
+    (addNode(args), ...);
 }
 
 template <typename T, typename Allocator>
 void BinaryTree<T, Allocator>::printCountOfNodes() const
 {
-    size_t nodes{count(root)};
-    std::cout << "Count of nodes = " << nodes << std::endl;
+    std::cout << "Count of nodes = " << nodesCount << std::endl;
+}
+
+template <typename T, typename Allocator>
+const T &BinaryTree<T, Allocator>::select(size_t k) const
+{
+    if (k >= nodesCount)
+        throw std::out_of_range("Exception: std::out_of_range: position " + std::to_string(k) +
+                                " is out of the binary tree of " + std::to_string(nodesCount) + " nodes");
+
+    const Node *node{root.get()};
+    size_t shift{leftSpineShift};
+    while (true)
+    {
+        const size_t leftSize{node->leftSize + shift};
+        if (k == leftSize)
+            return node->value;
+        if (k < leftSize)
+            node = node->leftRoot.get();
+        else
+        {
+            // Skipping left subtree and the node itself
+            k -= leftSize + 1UL;
+            node = node->rightRoot.get();
+            shift = 0;
+        }
+    }
+}
+
+template <typename T, typename Allocator>
+size_t BinaryTree<T, Allocator>::rank(const T &value) const
+{
+    size_t position{}, shift{leftSpineShift};
+    for (const Node *node{root.get()}; node not_eq nullptr;)
+    {
+        if (node->value < value)
+        {
+            // Left subtree and the node itself are lower than 'value'
+            position += node->leftSize + shift + 1UL;
+            node = node->rightRoot.get();
+            shift = 0;
+        }
+        else
+            node = node->leftRoot.get();
+    }
+    return position;
+}
+
+template <typename T, typename Allocator>
+typename BinaryTree<T, Allocator>::const_iterator BinaryTree<T, Allocator>::begin() const noexcept
+{
+    return const_iterator(minValue(root.get()), this);
+}
+
+template <typename T, typename Allocator>
+typename BinaryTree<T, Allocator>::const_iterator BinaryTree<T, Allocator>::end() const noexcept
+{
+    return const_iterator(nullptr, this);
+}
+
+template <typename T, typename Allocator>
+typename BinaryTree<T, Allocator>::const_iterator BinaryTree<T, Allocator>::lower_bound(const T &value) const
+{
+    // The last node where the search went left is the answer
+    const Node *found{};
+    for (const Node *node{root.get()}; node not_eq nullptr;)
+    {
+        if (node->value < value)
+            node = node->rightRoot.get();
+        else
+        {
+            found = node;
+            node = node->leftRoot.get();
+        }
+    }
+    return const_iterator(found, this);
+}
+
+template <typename T, typename Allocator>
+typename BinaryTree<T, Allocator>::const_iterator BinaryTree<T, Allocator>::upper_bound(const T &value) const
+{
+    const Node *found{};
+    for (const Node *node{root.get()}; node not_eq nullptr;)
+    {
+        if (value < node->value)
+        {
+            found = node;
+            node = node->leftRoot.get();
+        }
+        else
+            node = node->rightRoot.get();
+    }
+    return const_iterator(found, this);
+}
+
+template <typename T, typename Allocator>
+template <typename Fn>
+void BinaryTree<T, Allocator>::for_each_in_range(const T &lo, const T &hi, Fn &&fn) const
+{
+    for (auto it{lower_bound(lo)}; it not_eq end() and *it < hi; ++it)
+        fn(*it);
+}
+
+template <typename T, typename Allocator>
+FrozenBinaryTree<T> BinaryTree<T, Allocator>::freeze() const
+{
+    // Inorder walk gives values in ascending order, one value per call
+    std::vector<const Node *> stack;
+    const Node *node{root.get()};
+    return FrozenBinaryTree<T>(nodesCount, [&stack, &node]() -> const T &
+                               {
+                                   while (node not_eq nullptr)
+                                   {
+                                       stack.push_back(node);
+                                       node = node->leftRoot.get();
+                                   }
+                                   const Node *current{stack.back()};
+                                   stack.pop_back();
+                                   node = current->rightRoot.get();
+                                   return current->value; });
 }
 
 template <typename T, typename Allocator>
 void BinaryTree<T, Allocator>::printBranchesOfCertainNode(size_t nodeNumber)
 {
-    size_t branchesCount{branches(root, nodeNumber)};
+    size_t branchesCount{branches(root.get(), nodeNumber)};
 
-    if ((nodeNumber == 0) or (nodeNumber >= count(root)))
+    if ((nodeNumber == 0) or (nodeNumber >= nodesCount))
         branchesCount = 0;
 
     std::cout << "Count of branches on node " << nodeNumber << " is " << branchesCount << std::endl;
@@ -604,22 +1097,15 @@ void BinaryTree<T, Allocator>::printBranchesOfCertainNode(size_t nodeNumber)
 template <typename T, typename Allocator>
 void BinaryTree<T, Allocator>::printValueByNode(size_t nodeNumber)
 {
-    if (counter not_eq 0)
-        counter = 0;
-
-    std::shared_ptr<Node> pnode{certainNode(root, nodeNumber)};
-    if ((nodeNumber == 0) or (nodeNumber >= count(root)))
-        pnode->value = T{};
-    std::cout << "Value of " << transformNumber(nodeNumber) << " node is " << T_to_str(pnode->value) << std::endl;
+    const Node *pnode{certainNode(root.get(), nodeNumber)};
+    const T value{((nodeNumber == 0) or (nodeNumber >= nodesCount) or pnode == nullptr) ? T{} : pnode->value};
+    std::cout << "Value of " << transformNumber(nodeNumber) << " node is " << T_to_str(value) << std::endl;
 }
 
 template <typename T, typename Allocator>
 void BinaryTree<T, Allocator>::printNodeNumberByValue(const T &value)
 {
-    if (counter not_eq 0)
-        counter = 0;
-
-    size_t nodeNumber{searchNodeNumberByValue(root, value)};
+    size_t nodeNumber{searchNodeNumberByValue(root.get(), value)};
     if (nodeNumber == 0)
         std::cout << "The binary tree does not contain value " << T_to_str(value) << std::endl;
     else
@@ -629,27 +1115,30 @@ void BinaryTree<T, Allocator>::printNodeNumberByValue(const T &value)
 template <typename T, typename Allocator>
 void BinaryTree<T, Allocator>::searchMin()
 {
-    std::shared_ptr<Node> pnode{minValue(root)};
-    std::cout << "Min value = " << T_to_str(pnode->value) << std::endl;
+    const Node *pnode{minValue(root.get())};
+    if (pnode == nullptr)
+        std::cout << "Tree is empty " << std::endl;
+    else
+        std::cout << "Min value = " << T_to_str(pnode->value) << std::endl;
 }
 
 template <typename T, typename Allocator>
 void BinaryTree<T, Allocator>::searchMax()
 {
-    std::shared_ptr<Node> pnode = maxValue(root);
-    std::cout << "Max value = " << T_to_str(pnode->value) << std::endl;
+    const Node *pnode{maxValue(root.get())};
+    if (pnode == nullptr)
+        std::cout << "Tree is empty " << std::endl;
+    else
+        std::cout << "Max value = " << T_to_str(pnode->value) << std::endl;
 }
 
 template <typename T, typename Allocator>
 void BinaryTree<T, Allocator>::removeNode(const T &value)
 {
-    if (counter not_eq 0)
-        counter = 0;
-
     if (root == nullptr)
         std::cout << "There is no value " << T_to_str(value) << std::endl;
-    else
-        root = removeNodeByValue(root, value);
+    else if (removeNodeByValue(root, value))
+        leftmost = rightmost = nullptr;
 }
 
 #endif // BINTREE_IMPL_HPP
@@ -0,0 +1,114 @@
+#ifndef FROZEN_BINTREE_HPP
+#define FROZEN_BINTREE_HPP
+
+#include <cstddef>
+#include <iterator>
+
+/*
+ * @brief Immutable search tree stored in one array in Eytzinger (breadth-first) order:
+ * root is at index 1, children of the node 'k' are at '2k' and '2k + 1'. Search walks the array from
+ * the beginning without pointers and without branches on the comparison result, and the first levels of
+ * the tree share a few cache lines. Nodes 4 levels below the current one are consecutive, so they are
+ * prefetched while the current levels are compared.
+ * It is made by "BinaryTree::freeze()" or from a sorted range, it can't be modified
+ * @tparam T is the type of stored values
+ */
+template <typename T>
+class FrozenBinaryTree
+{
+public:
+    /// Size of a cache line, array is aligned to it
+    static constexpr size_t kCacheLine{64UL};
+
+private:
+    // Array of 'nodesCount + 1' slots, slot 0 is not used. "nullptr" if tree is empty
+    T *values{};
+
+    // Count of values in the tree
+    size_t nodesCount{};
+
+    /// Count of nodes in a cache line: nodes 'k * kPrefetchStride' and further are 4 levels below 'k'
+    static constexpr size_t kPrefetchStride{sizeof(T) < kCacheLine ? kCacheLine / sizeof(T) : 1UL};
+
+    /*
+     * @brief Helper method
+     * @param count count of nodes
+     * @returns Index of the min node (the first in sorted order), 0 if there are no nodes
+     */
+    static size_t firstIndex(size_t count) noexcept;
+
+    /*
+     * @brief Helper method, walks the array in sorted order without a stack
+     * @param index index of the node
+     * @param count count of nodes
+     * @returns Index of the next node in sorted order, 0 if 'index' is the last one
+     */
+    static size_t nextIndex(size_t index, size_t count) noexcept;
+
+    /// Allocates aligned array for 'count' values
+    static T *allocate(size_t count);
+
+    /// Frees array allocated by "allocate()"
+    static void deallocate(T *values) noexcept;
+
+    /// Destroys 'constructed' first (in sorted order) values of 'count' values and frees the array
+    static void destroy(T *values, size_t count, size_t constructed) noexcept;
+
+public:
+    /// Zero-argument, default ctor, makes an empty tree
+    FrozenBinaryTree(void) = default;
+
+    /*
+     * @brief Ctor from a generator of values
+     * @param count count of values
+     * @param next function that returns the next value, it is called 'count' times and values have to be
+     * in ascending order
+     */
+    template <typename Generator>
+    FrozenBinaryTree(size_t count, Generator &&next);
+
+    /*
+     * @brief Ctor from a sorted range
+     * @param first, last range of values in ascending order
+     */
+    template <typename ForwardIt,
+              typename = typename std::iterator_traits<ForwardIt>::iterator_category>
+    FrozenBinaryTree(ForwardIt first, ForwardIt last);
+
+    /// Copy ctor
+    FrozenBinaryTree(const FrozenBinaryTree &);
+
+    /// Move ctor, leaves moved tree empty
+    FrozenBinaryTree(FrozenBinaryTree &&) noexcept;
+
+    /// Copy assignment operator
+    FrozenBinaryTree &operator=(const FrozenBinaryTree &);
+
+    /// Move assignment operator, leaves moved tree empty
+    FrozenBinaryTree &operator=(FrozenBinaryTree &&) noexcept;
+
+    /// Dtor
+    ~FrozenBinaryTree(void);
+
+    /// Returns count of values
+    constexpr size_t size(void) const noexcept { return nodesCount; }
+
+    /// Returns "true" if there are no values
+    constexpr bool empty(void) const noexcept { return nodesCount == 0; }
+
+    /*
+     * @brief Searching the first value that is not lower than specified one (Non-recursive, branchless)
+     * @tparam value value to search
+     * @returns Pointer on the found value, "nullptr" if all values are lower than 'value'
+     */
+    const T *lower_bound(const T &value) const noexcept;
+
+    /*
+     * @brief Checking presence of value (Non-recursive, branchless)
+     * @tparam value value to search
+     * @returns "true" if tree contains 'value'
+     */
+    bool contains(const T &value) const noexcept;
+};
+
+#endif // !FROZEN_BINTREE_HPP
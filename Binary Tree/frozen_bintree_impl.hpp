@@ -0,0 +1,185 @@
+#ifndef FROZEN_BINTREE_IMPL_HPP
+#define FROZEN_BINTREE_IMPL_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "frozen_bintree.hpp"
+
+template <typename T>
+size_t FrozenBinaryTree<T>::firstIndex(size_t count) noexcept
+{
+    if (count == 0)
+        return 0;
+    // Min node is the last one on the left spine
+    size_t index{1};
+    while (index * 2UL <= count)
+        index *= 2UL;
+    return index;
+}
+
+template <typename T>
+size_t FrozenBinaryTree<T>::nextIndex(size_t index, size_t count) noexcept
+{
+    // Min node of the right subtree
+    if (index * 2UL + 1UL <= count)
+    {
+        index = index * 2UL + 1UL;
+        while (index * 2UL <= count)
+            index *= 2UL;
+        return index;
+    }
+    // Going up while node is a right child, then the parent is the next one
+    while (index & 1UL)
+        index >>= 1;
+    return index >> 1;
+}
+
+template <typename T>
+T *FrozenBinaryTree<T>::allocate(size_t count)
+{
+    return static_cast<T *>(::operator new((count + 1UL) * sizeof(T),
+                                           std::align_val_t{std::max(kCacheLine, alignof(T))}));
+}
+
+template <typename T>
+void FrozenBinaryTree<T>::deallocate(T *values) noexcept
+{
+    ::operator delete(values, std::align_val_t{std::max(kCacheLine, alignof(T))});
+}
+
+template <typename T>
+void FrozenBinaryTree<T>::destroy(T *values, size_t count, size_t constructed) noexcept
+{
+    if (values == nullptr)
+        return;
+    if constexpr (not std::is_trivially_destructible_v<T>)
+    {
+        // Values were constructed in sorted order, not in order of the array
+        for (size_t index{firstIndex(count)}; constructed not_eq 0; index = nextIndex(index, count), --constructed)
+            values[index].~T();
+    }
+    deallocate(values);
+}
+
+template <typename T>
+template <typename Generator>
+FrozenBinaryTree<T>::FrozenBinaryTree(size_t count, Generator &&next)
+{
+    if (count == 0)
+        return;
+
+    T *array{allocate(count)};
+    size_t constructed{};
+    try
+    {
+        // Inorder walk of the implicit tree visits its slots in ascending order of values
+        for (size_t index{firstIndex(count)}; index not_eq 0; index = nextIndex(index, count))
+        {
+            ::new (static_cast<void *>(array + index)) T(next());
+            ++constructed;
+        }
+    }
+    catch (...)
+    {
+        destroy(array, count, constructed);
+        throw;
+    }
+    values = array;
+    nodesCount = count;
+}
+
+template <typename T>
+template <typename ForwardIt, typename>
+FrozenBinaryTree<T>::FrozenBinaryTree(ForwardIt first, ForwardIt last)
+    : FrozenBinaryTree(static_cast<size_t>(std::distance(first, last)), [&first]
+                       { return *first++; }) {}
+
+template <typename T>
+FrozenBinaryTree<T>::FrozenBinaryTree(const FrozenBinaryTree &frozen_tree)
+{
+    if (frozen_tree.nodesCount == 0)
+        return;
+
+    T *array{allocate(frozen_tree.nodesCount)};
+    try
+    {
+        std::uninitialized_copy(frozen_tree.values + 1, frozen_tree.values + frozen_tree.nodesCount + 1, array + 1);
+    }
+    catch (...)
+    {
+        deallocate(array);
+        throw;
+    }
+    values = array;
+    nodesCount = frozen_tree.nodesCount;
+}
+
+template <typename T>
+FrozenBinaryTree<T>::FrozenBinaryTree(FrozenBinaryTree &&frozen_tree) noexcept
+    : values(std::exchange(frozen_tree.values, nullptr)), nodesCount(std::exchange(frozen_tree.nodesCount, 0)) {}
+
+template <typename T>
+FrozenBinaryTree<T> &FrozenBinaryTree<T>::operator=(const FrozenBinaryTree &frozen_tree)
+{
+    // Checking self-assignment
+    if (this not_eq &frozen_tree)
+        *this = FrozenBinaryTree(frozen_tree);
+    return *this;
+}
+
+template <typename T>
+FrozenBinaryTree<T> &FrozenBinaryTree<T>::operator=(FrozenBinaryTree &&frozen_tree) noexcept
+{
+    // Checking self-assignment
+    if (this == &frozen_tree)
+        return *this;
+
+    destroy(values, nodesCount, nodesCount);
+    values = std::exchange(frozen_tree.values, nullptr);
+    nodesCount = std::exchange(frozen_tree.nodesCount, 0);
+    return *this;
+}
+
+template <typename T>
+FrozenBinaryTree<T>::~FrozenBinaryTree() { destroy(values, nodesCount, nodesCount); }
+
+template <typename T>
+const T *FrozenBinaryTree<T>::lower_bound(const T &value) const noexcept
+{
+    size_t index{1};
+    while (index <= nodesCount)
+    {
+#if defined(__GNUC__)
+        // Address is computed in integers: it may be out of the array, prefetch doesn't fault on it
+        __builtin_prefetch(reinterpret_cast<const void *>(reinterpret_cast<std::uintptr_t>(values) +
+                                                          index * kPrefetchStride * sizeof(T)));
+#endif
+        // Going left or right without a branch: result of comparison is the last bit of the child index
+        index = index * 2UL + static_cast<size_t>(values[index] < value);
+    }
+
+    // Bits of the index are the path from the root (1 - right, 0 - left). The answer is the last node
+    // where the search went left: cancelling trailing right turns and the last left turn gives it
+#if defined(__GNUC__)
+    index >>= __builtin_ctzll(~static_cast<unsigned long long>(index)) + 1;
+#else
+    while (index & 1UL)
+        index >>= 1;
+    index >>= 1;
+#endif
+    return index == 0 ? nullptr : values + index;
+}
+
+template <typename T>
+bool FrozenBinaryTree<T>::contains(const T &value) const noexcept
+{
+    const T *found{lower_bound(value)};
+    return found not_eq nullptr and not(value < *found);
+}
+
+#endif // !FROZEN_BINTREE_IMPL_HPP
@@ -0,0 +1,123 @@
+#ifndef NODE_POOL_ALLOCATOR_HPP
+#define NODE_POOL_ALLOCATOR_HPP
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Slab (arena) of small fixed-size blocks for tree nodes.
+ * Memory is taken from the system in large chunks, blocks are carved from the current chunk one by one
+ * and freed blocks go to the free list of their size class, so the next allocation of the same size
+ * reuses them. Chunks are returned to the system only when the pool is destroyed.
+ * Blocks are rounded up to 'kGranularity' bytes, blocks bigger than 'kMaxBlockSize' aren't served by the pool.
+ * Pool isn't thread-safe: all containers that use it have to be modified from one thread at a time.
+ */
+class NodePool
+{
+public:
+    /// @brief Blocks are aligned to and rounded up to this count of bytes
+    static constexpr size_t kGranularity{alignof(std::max_align_t)};
+
+    /// @brief Max size of a block served by the pool
+    static constexpr size_t kMaxBlockSize{256ul};
+
+    /// @brief Size of a chunk taken from the system
+    static constexpr size_t kChunkSize{1ul << 16};
+
+    NodePool() noexcept = default;
+    NodePool(NodePool const &) = delete;
+    NodePool &operator=(NodePool const &) = delete;
+
+    /// @brief Frees all the chunks. Blocks that are still in use become dangling
+    ~NodePool();
+
+    /**
+     * @brief Gives a block of at least 'bytes' bytes
+     * @throws "std::bad_alloc" if new chunk can't be allocated
+     */
+    void *allocate(size_t bytes);
+
+    /// @brief Returns block given by "allocate()" with the same 'bytes' to the free list
+    void deallocate(void *p, size_t bytes) noexcept;
+
+    /// @return "true" if block of 'bytes' bytes and 'alignment' is served by the pool
+    static constexpr bool fits(size_t bytes, size_t alignment) noexcept
+    {
+        return bytes != 0 && bytes <= kMaxBlockSize && alignment <= kGranularity;
+    }
+
+    /// @return Count of bytes taken from the system
+    size_t bytesReserved() const noexcept { return m_chunks.size() * kChunkSize; }
+
+    /// @return Count of blocks given out and not returned yet
+    constexpr size_t blocksInUse() const noexcept { return m_blocksInUse; }
+
+private:
+    /// @brief Freed block, stores pointer to the next freed block of the same size
+    struct FreeBlock
+    {
+        FreeBlock *next;
+    };
+
+    /// @brief Blocks of one size
+    struct SizeClass
+    {
+        FreeBlock *freeList{};
+        std::byte *current{}; // Next uncarved block in the chunk of this class
+        std::byte *end{};     // End of the chunk of this class
+    };
+
+    static constexpr size_t classIndex(size_t bytes) noexcept { return (bytes - 1ul) / kGranularity; }
+
+    std::array<SizeClass, kMaxBlockSize / kGranularity> m_classes{};
+    std::vector<std::byte *> m_chunks;
+    size_t m_blocksInUse{};
+};
+
+/**
+ * @brief Allocator that takes single objects from 'NodePool'.
+ * Copies and rebound copies share the pool, so node-based containers (which rebind the allocator
+ * to their node type) carve all the nodes from the same chunks. Arrays and objects too big
+ * for the pool come from "std::allocator". The pool has to outlive all the containers using it.
+ * @tparam T type of the objects
+ */
+template <typename T>
+class NodePoolAllocator
+{
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    /// @param pool pool to take blocks from
+    explicit NodePoolAllocator(NodePool &pool) noexcept : m_pool(&pool) {}
+
+    template <typename U>
+    NodePoolAllocator(NodePoolAllocator<U> const &other) noexcept : m_pool(other.pool()) {}
+
+    /**
+     * @brief Allocates storage for 'n' objects
+     * @throws "std::bad_alloc" if storage can't be allocated
+     */
+    T *allocate(size_t n);
+
+    /// @brief Frees storage allocated with "allocate()" for 'n' objects
+    void deallocate(T *p, size_t n) noexcept;
+
+    /// @return Pool that gives blocks to this allocator
+    constexpr NodePool *pool() const noexcept { return m_pool; }
+
+    template <typename U>
+    bool operator==(NodePoolAllocator<U> const &other) const noexcept { return m_pool == other.pool(); }
+
+    template <typename U>
+    bool operator!=(NodePoolAllocator<U> const &other) const noexcept { return m_pool != other.pool(); }
+
+private:
+    NodePool *m_pool;
+};
+
+#endif // !NODE_POOL_ALLOCATOR_HPP
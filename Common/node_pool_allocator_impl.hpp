@@ -0,0 +1,66 @@
+#ifndef NODE_POOL_ALLOCATOR_IMPL_HPP
+#define NODE_POOL_ALLOCATOR_IMPL_HPP
+
+#include <new>
+#include <utility>
+
+#include "node_pool_allocator.hpp"
+
+inline NodePool::~NodePool()
+{
+    for (std::byte *chunk : m_chunks)
+        ::operator delete(chunk);
+}
+
+inline void *NodePool::allocate(size_t bytes)
+{
+    SizeClass &sizeClass{m_classes[classIndex(bytes)]};
+    const size_t blockSize{(classIndex(bytes) + 1ul) * kGranularity};
+
+    // Freed blocks first: they were touched recently and are likely still in cache
+    if (sizeClass.freeList)
+    {
+        void *p{std::exchange(sizeClass.freeList, sizeClass.freeList->next)};
+        m_blocksInUse++;
+        return p;
+    }
+
+    if (sizeClass.current == sizeClass.end)
+    {
+        // Reserve the slot first, so 'push_back()' can't throw after the chunk is allocated
+        m_chunks.reserve(m_chunks.size() + 1ul);
+        std::byte *chunk{static_cast<std::byte *>(::operator new(kChunkSize))};
+        m_chunks.push_back(chunk);
+        sizeClass.current = chunk;
+        sizeClass.end = chunk + kChunkSize / blockSize * blockSize;
+    }
+
+    m_blocksInUse++;
+    return std::exchange(sizeClass.current, sizeClass.current + blockSize);
+}
+
+inline void NodePool::deallocate(void *p, size_t bytes) noexcept
+{
+    SizeClass &sizeClass{m_classes[classIndex(bytes)]};
+    sizeClass.freeList = ::new (p) FreeBlock{sizeClass.freeList};
+    m_blocksInUse--;
+}
+
+template <typename T>
+T *NodePoolAllocator<T>::allocate(size_t n)
+{
+    if (n == 1ul && NodePool::fits(sizeof(T), alignof(T)))
+        return static_cast<T *>(m_pool->allocate(sizeof(T)));
+    return std::allocator<T>().allocate(n);
+}
+
+template <typename T>
+void NodePoolAllocator<T>::deallocate(T *p, size_t n) noexcept
+{
+    if (n == 1ul && NodePool::fits(sizeof(T), alignof(T)))
+        m_pool->deallocate(p, sizeof(T));
+    else
+        std::allocator<T>().deallocate(p, n);
+}
+
+#endif // !NODE_POOL_ALLOCATOR_IMPL_HPP
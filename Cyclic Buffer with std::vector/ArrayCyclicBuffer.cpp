@@ -0,0 +1,100 @@
+#include "ArrayCyclicBuffer.hpp"
+
+template <typename T, size_t N>
+    requires(std::has_single_bit(N))
+constexpr size_t ArrayCyclicBuffer<T, N>::getSize() const
+{
+    return m_size;
+}
+
+template <typename T, size_t N>
+    requires(std::has_single_bit(N))
+constexpr size_t ArrayCyclicBuffer<T, N>::getCapacity() const
+{
+    return N;
+}
+
+template <typename T, size_t N>
+    requires(std::has_single_bit(N))
+constexpr const T &ArrayCyclicBuffer<T, N>::getData(const size_t &pos) const
+{
+    return m_buf.at(pos);
+}
+
+template <typename T, size_t N>
+    requires(std::has_single_bit(N))
+constexpr const T &ArrayCyclicBuffer<T, N>::getBack() const
+{
+    return m_buf[(m_backElem - 1UL) & m_kMask];
+}
+
+template <typename T, size_t N>
+    requires(std::has_single_bit(N))
+constexpr const T &ArrayCyclicBuffer<T, N>::getFront() const
+{
+    return m_buf[(m_frontElem + 1UL) & m_kMask];
+}
+
+template <typename T, size_t N>
+    requires(std::has_single_bit(N))
+constexpr bool ArrayCyclicBuffer<T, N>::empty() const
+{
+    return m_size == 0UL;
+}
+
+template <typename T, size_t N>
+    requires(std::has_single_bit(N))
+constexpr bool ArrayCyclicBuffer<T, N>::try_pushBack(const T &data)
+{
+    if (m_size == N)
+        return false;
+    m_buf[m_backElem] = data;
+    m_backElem = (m_backElem + 1UL) & m_kMask;
+    m_size++;
+    return true;
+}
+
+template <typename T, size_t N>
+    requires(std::has_single_bit(N))
+constexpr bool ArrayCyclicBuffer<T, N>::try_pushFront(const T &data)
+{
+    if (m_size == N)
+        return false;
+    m_buf[m_frontElem] = data;
+    m_frontElem = (m_frontElem - 1UL) & m_kMask;
+    m_size++;
+    return true;
+}
+
+template <typename T, size_t N>
+    requires(std::has_single_bit(N))
+constexpr bool ArrayCyclicBuffer<T, N>::try_popBack()
+{
+    if (m_size == 0UL)
+        return false;
+    m_backElem = (m_backElem - 1UL) & m_kMask;
+    m_size--;
+    return true;
+}
+
+template <typename T, size_t N>
+    requires(std::has_single_bit(N))
+constexpr bool ArrayCyclicBuffer<T, N>::try_popFront()
+{
+    if (m_size == 0UL)
+        return false;
+    m_frontElem = (m_frontElem + 1UL) & m_kMask;
+    m_size--;
+    return true;
+}
+
+template <typename T, size_t N>
+    requires(std::has_single_bit(N))
+constexpr void ArrayCyclicBuffer<T, N>::printBuffer() const
+{
+    for (const T &elem : m_buf)
+    {
+        std::cout << elem << ' ';
+    }
+    std::endl(std::cout);
+}
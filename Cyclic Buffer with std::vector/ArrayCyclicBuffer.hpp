@@ -0,0 +1,44 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <iostream>
+
+// Fixed-size cyclic buffer with compile-time capacity 'N'.
+// 'N' has to be a power of two, so wrapping of indices is a bitwise AND with 'N - 1'
+// instead of a division. Storage is held inline in 'std::array', no heap allocation.
+template <typename T, size_t N>
+    requires(std::has_single_bit(N))
+class ArrayCyclicBuffer
+{
+private:
+    static constexpr size_t m_kMask{N - 1UL};
+
+    std::array<T, N> m_buf{};
+    size_t m_size{0UL};
+    size_t m_frontElem{N - 1UL};
+    size_t m_backElem{0UL};
+
+public:
+    explicit ArrayCyclicBuffer() = default;
+    explicit ArrayCyclicBuffer(const ArrayCyclicBuffer &) = default;
+    explicit ArrayCyclicBuffer(ArrayCyclicBuffer &&) = default;
+    ArrayCyclicBuffer &operator=(const ArrayCyclicBuffer &) = default;
+    ArrayCyclicBuffer &operator=(ArrayCyclicBuffer &&) = default;
+    virtual ~ArrayCyclicBuffer() = default;
+
+    constexpr size_t getSize() const;
+    constexpr size_t getCapacity() const;
+    constexpr const T &getData(const size_t &) const;
+    constexpr const T &getBack() const;
+    constexpr const T &getFront() const;
+
+    constexpr bool empty() const;
+
+    constexpr bool try_pushBack(const T &);
+    constexpr bool try_pushFront(const T &);
+    constexpr bool try_popBack();
+    constexpr bool try_popFront();
+
+    constexpr void printBuffer() const;
+};
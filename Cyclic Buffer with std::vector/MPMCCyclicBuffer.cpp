@@ -0,0 +1,131 @@
+#include <bit>
+
+#include "MPMCCyclicBuffer.hpp"
+
+template <typename T, class Allocator>
+struct MPMCCyclicBuffer<T, Allocator>::Cell
+{
+    std::atomic<size_t> m_sequence;
+    T m_data;
+};
+
+template <typename T, class Allocator>
+MPMCCyclicBuffer<T, Allocator>::MPMCCyclicBuffer(const size_t &size)
+    : m_buf(std::bit_ceil(size < 2UL ? 2UL : size)), m_mask(m_buf.size() - 1UL),
+      m_enqueuePos(0UL), m_dequeuePos(0UL)
+{
+    for (size_t i{0UL}; i < m_buf.size(); i++)
+        m_buf[i].m_sequence.store(i, std::memory_order_relaxed);
+}
+
+template <typename T, class Allocator>
+size_t MPMCCyclicBuffer<T, Allocator>::getSize() const
+{
+    const size_t dequeuePos{m_dequeuePos.load(std::memory_order_acquire)};
+    const size_t enqueuePos{m_enqueuePos.load(std::memory_order_acquire)};
+    return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0UL;
+}
+
+template <typename T, class Allocator>
+constexpr size_t MPMCCyclicBuffer<T, Allocator>::getCapacity() const
+{
+    return m_mask + 1UL;
+}
+
+template <typename T, class Allocator>
+bool MPMCCyclicBuffer<T, Allocator>::empty() const
+{
+    return getSize() == 0UL;
+}
+
+template <typename T, class Allocator>
+struct MPMCCyclicBuffer<T, Allocator>::Cell *
+MPMCCyclicBuffer<T, Allocator>::claimPushCell(size_t &pos)
+{
+    pos = m_enqueuePos.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        Cell *cell{&m_buf[pos & m_mask]};
+        const size_t sequence{cell->m_sequence.load(std::memory_order_acquire)};
+        const auto diff{static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos)};
+
+        // Slot is free for this lap: try to claim it
+        if (diff == 0)
+        {
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + 1UL, std::memory_order_relaxed))
+                return cell;
+        }
+        // Slot still holds an element from the previous lap -> buffer is full
+        else if (diff < 0)
+            return nullptr;
+        // Another producer claimed the slot, reload the position
+        else
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+    }
+}
+
+template <typename T, class Allocator>
+bool MPMCCyclicBuffer<T, Allocator>::try_pushBack(const T &data)
+{
+    size_t pos;
+    Cell *cell{claimPushCell(pos)};
+    if (cell == nullptr)
+        return false;
+
+    cell->m_data = data;
+    cell->m_sequence.store(pos + 1UL, std::memory_order_release);
+    return true;
+}
+
+template <typename T, class Allocator>
+bool MPMCCyclicBuffer<T, Allocator>::try_pushBack(T &&data)
+{
+    size_t pos;
+    Cell *cell{claimPushCell(pos)};
+    if (cell == nullptr)
+        return false;
+
+    cell->m_data = std::move(data);
+    cell->m_sequence.store(pos + 1UL, std::memory_order_release);
+    return true;
+}
+
+template <typename T, class Allocator>
+bool MPMCCyclicBuffer<T, Allocator>::try_popFront(T &data)
+{
+    Cell *cell;
+    size_t pos{m_dequeuePos.load(std::memory_order_relaxed)};
+
+    while (true)
+    {
+        cell = &m_buf[pos & m_mask];
+        const size_t sequence{cell->m_sequence.load(std::memory_order_acquire)};
+        const auto diff{static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1UL)};
+
+        // Slot was published by a producer: try to claim it
+        if (diff == 0)
+        {
+            if (m_dequeuePos.compare_exchange_weak(pos, pos + 1UL, std::memory_order_relaxed))
+                break;
+        }
+        // Producer has not filled this slot yet -> buffer is empty
+        else if (diff < 0)
+            return false;
+        // Another consumer claimed the slot, reload the position
+        else
+            pos = m_dequeuePos.load(std::memory_order_relaxed);
+    }
+
+    data = std::move(cell->m_data);
+    // Mark the slot as free for the producers of the next lap
+    cell->m_sequence.store(pos + m_mask + 1UL, std::memory_order_release);
+    return true;
+}
+
+template <typename T, class Allocator>
+bool MPMCCyclicBuffer<T, Allocator>::try_popFront()
+{
+    T data;
+    return try_popFront(data);
+}
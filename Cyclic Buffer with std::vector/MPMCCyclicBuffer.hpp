@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// Bounded lock-free multi-producer/multi-consumer cyclic buffer (D. Vyukov's algorithm).
+// Every slot carries a sequence number that tells producers and consumers
+// whose turn it is, so threads only contend on the index they advance.
+// Capacity is rounded up to the power of two.
+template <typename T, class Allocator = std::allocator<T>>
+class MPMCCyclicBuffer
+{
+private:
+    static constexpr size_t m_kCacheLineSize{64UL};
+
+    struct Cell;
+    using CellAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Cell>;
+
+    std::vector<Cell, CellAllocator> m_buf;
+    size_t m_mask;
+
+    alignas(m_kCacheLineSize) std::atomic<size_t> m_enqueuePos;
+    alignas(m_kCacheLineSize) std::atomic<size_t> m_dequeuePos;
+
+    // Reserves a slot for a producer, returns "nullptr" if buffer is full
+    Cell *claimPushCell(size_t &);
+
+public:
+    explicit MPMCCyclicBuffer(const MPMCCyclicBuffer &) = delete;
+    explicit MPMCCyclicBuffer(MPMCCyclicBuffer &&) = delete;
+    MPMCCyclicBuffer &operator=(const MPMCCyclicBuffer &) = delete;
+    MPMCCyclicBuffer &operator=(MPMCCyclicBuffer &&) = delete;
+    virtual ~MPMCCyclicBuffer() = default;
+
+    explicit MPMCCyclicBuffer(const size_t &);
+
+    size_t getSize() const;
+    constexpr size_t getCapacity() const;
+
+    bool empty() const;
+
+    bool try_pushBack(const T &);
+    bool try_pushBack(T &&);
+    bool try_popFront(T &);
+    bool try_popFront();
+};
@@ -4,7 +4,7 @@ template <typename T, class Allocator>
 struct VectorCyclicBuffer<T, Allocator>::BufData
 {
     std::vector<T, Allocator> m_buf;
-    size_t m_pos;
+    size_t m_capacity;
     size_t m_size;
     size_t m_frontElem;
     size_t m_backElem;
@@ -14,8 +14,8 @@ template <typename T, class Allocator>
 VectorCyclicBuffer<T, Allocator>::VectorCyclicBuffer(const size_t &size)
 {
     m_bufData.m_buf.resize(size);
-    m_bufData.m_pos = 0UL;
-    m_bufData.m_size = size;
+    m_bufData.m_capacity = size;
+    m_bufData.m_size = 0UL;
     m_bufData.m_frontElem = size - 1UL;
     m_bufData.m_backElem = 0UL;
 }
@@ -41,28 +41,28 @@ constexpr T &VectorCyclicBuffer<T, Allocator>::getData(const size_t &pos) const
 template <typename T, class Allocator>
 auto &VectorCyclicBuffer<T, Allocator>::getBack() const
 {
-    return m_bufData.m_buf.at((m_bufData.m_backElem - 1UL + m_bufData.m_size) % m_bufData.m_size);
+    return m_bufData.m_buf.at((m_bufData.m_backElem - 1UL + m_bufData.m_capacity) % m_bufData.m_capacity);
 }
 
 template <typename T, class Allocator>
 auto &VectorCyclicBuffer<T, Allocator>::getFront() const
 {
-    return m_bufData.m_buf.at((m_bufData.m_frontElem + 1UL) % m_bufData.m_size);
+    return m_bufData.m_buf.at((m_bufData.m_frontElem + 1UL) % m_bufData.m_capacity);
 }
 
 template <typename T, class Allocator>
 constexpr bool VectorCyclicBuffer<T, Allocator>::empty() const
 {
-    return m_bufData.m_buf.empty();
+    return m_bufData.m_size == 0UL;
 }
 
 template <typename T, class Allocator>
 constexpr bool VectorCyclicBuffer<T, Allocator>::try_pushBack(const T &data)
 {
-    if (m_bufData.m_pos == m_bufData.m_size)
+    if (m_bufData.m_size == m_bufData.m_capacity)
         return false;
     m_bufData.m_buf[m_bufData.m_backElem] = data;
-    m_bufData.m_backElem = (m_bufData.m_backElem + 1UL) % m_bufData.m_size;
+    m_bufData.m_backElem = (m_bufData.m_backElem + 1UL) % m_bufData.m_capacity;
     m_bufData.m_size++;
     return true;
 }
@@ -70,10 +70,10 @@ constexpr bool VectorCyclicBuffer<T, Allocator>::try_pushBack(const T &data)
 template <typename T, class Allocator>
 constexpr bool VectorCyclicBuffer<T, Allocator>::try_pushFront(const T &data)
 {
-    if (m_bufData.m_pos == m_bufData.m_size)
+    if (m_bufData.m_size == m_bufData.m_capacity)
         return false;
     m_bufData.m_buf[m_bufData.m_frontElem] = data;
-    m_bufData.m_frontElem = (m_bufData.m_frontElem - 1UL + m_bufData.m_size) % m_bufData.m_size;
+    m_bufData.m_frontElem = (m_bufData.m_frontElem - 1UL + m_bufData.m_capacity) % m_bufData.m_capacity;
     m_bufData.m_size++;
     return true;
 }
@@ -81,9 +81,9 @@ constexpr bool VectorCyclicBuffer<T, Allocator>::try_pushFront(const T &data)
 template <typename T, class Allocator>
 constexpr bool VectorCyclicBuffer<T, Allocator>::try_popBack()
 {
-    if (m_bufData.m_pos == m_bufData.m_size)
+    if (m_bufData.m_size == 0UL)
         return false;
-    m_bufData.m_backElem = (m_bufData.m_backElem - 1UL + m_bufData.m_size) % m_bufData.m_size;
+    m_bufData.m_backElem = (m_bufData.m_backElem - 1UL + m_bufData.m_capacity) % m_bufData.m_capacity;
     m_bufData.m_size--;
     return true;
 }
@@ -91,9 +91,9 @@ constexpr bool VectorCyclicBuffer<T, Allocator>::try_popBack()
 template <typename T, class Allocator>
 constexpr bool VectorCyclicBuffer<T, Allocator>::try_popFront()
 {
-    if (m_bufData.m_pos == m_bufData.m_size)
+    if (m_bufData.m_size == 0UL)
         return false;
-    m_bufData.m_frontElem = (m_bufData.m_frontElem + 1UL) % m_bufData.m_size;
+    m_bufData.m_frontElem = (m_bufData.m_frontElem + 1UL) % m_bufData.m_capacity;
     m_bufData.m_size--;
     return true;
 }
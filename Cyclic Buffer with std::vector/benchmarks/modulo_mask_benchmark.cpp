@@ -0,0 +1,54 @@
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <string>
+
+#include "../VectorCyclicBuffer.hpp"
+#include "../VectorCyclicBuffer.cpp"
+#include "../ArrayCyclicBuffer.hpp"
+#include "../ArrayCyclicBuffer.cpp"
+
+constexpr size_t kCapacity{1024UL};
+
+// Keeps the buffer half full and cycles elements through both ends,
+// so every operation wraps indices once
+template <typename Buffer>
+double run(Buffer &buffer, const size_t &iterations, uint64_t &checksum)
+{
+    for (size_t i{0UL}; i < kCapacity / 2UL; i++)
+        buffer.try_pushBack(i);
+
+    // Local accumulator, so the compiler doesn't have to assume it aliases the buffer
+    uint64_t sum{0UL};
+    const auto start{std::chrono::steady_clock::now()};
+    for (size_t i{0UL}; i < iterations; i++)
+    {
+        sum += buffer.getFront();
+        buffer.try_popFront();
+        buffer.try_pushBack(i);
+        sum ^= buffer.getBack();
+    }
+    const std::chrono::duration<double, std::nano> elapsed{std::chrono::steady_clock::now() - start};
+    checksum += sum;
+    return elapsed.count() / iterations;
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t iterations{argc > 1 ? std::stoul(argv[1]) : 100'000'000UL};
+    uint64_t checksum{0UL};
+
+    std::cout << "Iterations: " << iterations << ", capacity: " << kCapacity << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+
+    // Capacity of the runtime-sized buffer is hidden from the optimizer, as it is in real code
+    volatile size_t capacity{kCapacity};
+    VectorCyclicBuffer<uint64_t> modulo(static_cast<size_t>(capacity));
+    std::cout << "modulo (VectorCyclicBuffer):      " << run(modulo, iterations, checksum) << " ns/iteration" << std::endl;
+
+    ArrayCyclicBuffer<uint64_t, kCapacity> masked;
+    std::cout << "mask   (ArrayCyclicBuffer<1024>): " << run(masked, iterations, checksum) << " ns/iteration" << std::endl;
+
+    std::cout << "Checksum: " << checksum << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../MPMCCyclicBuffer.hpp"
+#include "../MPMCCyclicBuffer.cpp"
+
+struct Result
+{
+    double throughput;
+    double p99LatencyNs;
+};
+
+// Every producer pushes 'itemsPerProducer' values, consumers share the total count.
+// Enqueue latency is measured from the first attempt to the successful push (retries included).
+Result run(const size_t &producers, const size_t &consumers, const size_t &itemsPerProducer, const size_t &capacity)
+{
+    MPMCCyclicBuffer<size_t> buffer(capacity);
+    const size_t total{producers * itemsPerProducer};
+    std::atomic<size_t> consumed{0UL};
+    std::atomic<bool> go{false};
+    std::vector<std::vector<uint32_t>> latencies(producers);
+    std::vector<std::thread> threads;
+
+    for (size_t p{0UL}; p < producers; p++)
+        threads.emplace_back([&, p]()
+                             {
+            auto &samples{latencies[p]};
+            samples.reserve(itemsPerProducer);
+            while (!go.load(std::memory_order_acquire))
+                std::this_thread::yield();
+
+            for (size_t i{0UL}; i < itemsPerProducer; i++)
+            {
+                const auto start{std::chrono::steady_clock::now()};
+                while (!buffer.try_pushBack(i))
+                    std::this_thread::yield();
+                const auto stop{std::chrono::steady_clock::now()};
+                samples.push_back(static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()));
+            } });
+
+    for (size_t c{0UL}; c < consumers; c++)
+        threads.emplace_back([&]()
+                             {
+            size_t value{};
+            while (!go.load(std::memory_order_acquire))
+                std::this_thread::yield();
+
+            while (consumed.load(std::memory_order_relaxed) < total)
+            {
+                if (buffer.try_popFront(value))
+                    consumed.fetch_add(1UL, std::memory_order_relaxed);
+                else
+                    std::this_thread::yield();
+            } });
+
+    const auto start{std::chrono::steady_clock::now()};
+    go.store(true, std::memory_order_release);
+    for (auto &thread : threads)
+        thread.join();
+    const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+
+    std::vector<uint32_t> all;
+    all.reserve(total);
+    for (const auto &samples : latencies)
+        all.insert(all.end(), samples.begin(), samples.end());
+    auto p99{all.begin() + static_cast<std::ptrdiff_t>(all.size() * 99UL / 100UL)};
+    std::nth_element(all.begin(), p99, all.end());
+
+    return {total / elapsed.count(), static_cast<double>(*p99)};
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t maxThreads{argc > 1 ? std::stoul(argv[1]) : std::max(2U, std::thread::hardware_concurrency())};
+    const size_t itemsPerProducer{argc > 2 ? std::stoul(argv[2]) : 1'000'000UL};
+    const size_t capacity{argc > 3 ? std::stoul(argv[3]) : 1024UL};
+
+    std::cout << "Items per producer: " << itemsPerProducer << ", capacity: " << capacity << std::endl;
+    std::cout << std::setw(10) << "producers" << std::setw(10) << "consumers"
+              << std::setw(14) << "Mops/s" << std::setw(16) << "p99 push, ns" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    for (size_t producers{1UL}; producers <= maxThreads; producers *= 2UL)
+        for (size_t consumers{1UL}; consumers <= maxThreads; consumers *= 2UL)
+        {
+            const Result result{run(producers, consumers, itemsPerProducer, capacity)};
+            std::cout << std::setw(10) << producers << std::setw(10) << consumers
+                      << std::setw(14) << result.throughput / 1e6 << std::setw(16) << result.p99LatencyNs << std::endl;
+        }
+
+    return EXIT_SUCCESS;
+}
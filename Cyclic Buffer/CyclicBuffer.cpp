@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <type_traits>
+
 #include "CyclicBuffer.hpp"
 
 template <typename T, class Allocator>
@@ -7,43 +10,148 @@ struct CyclicBuffer<T, Allocator>::BufData
     size_t m_pos;
     size_t m_size;
     size_t m_capacity;
+    size_t m_dropped;
+    std::atomic<size_t> m_sequence;
 };
 
 template <typename T, class Allocator>
 void CyclicBuffer<T, Allocator>::copyObj(const CyclicBuffer &obj)
 {
-    m_bufData.m_buf = std::move(obj.m_bufData.m_buf);
-    m_bufData.m_pos = obj.m_bufData.m_pos;
-    m_bufData.m_size = obj.m_bufData.m_size;
+    m_bufData.m_buf = AllocTraits::allocate(allocator, obj.m_bufData.m_capacity);
+    m_bufData.m_pos = 0UL;
+    m_bufData.m_size = 0UL;
     m_bufData.m_capacity = obj.m_bufData.m_capacity;
+    m_bufData.m_dropped = obj.m_bufData.m_dropped;
+
+    // Copy is stored unrolled: the oldest element at index 0
+    for (const auto &span : obj.getReadSpans())
+        for (const T &elem : span)
+            pushBack(elem);
+}
+
+template <typename T, class Allocator>
+void CyclicBuffer<T, Allocator>::moveObj(CyclicBuffer &lhs)
+{
+    m_bufData.m_buf = lhs.m_bufData.m_buf;
+    m_bufData.m_pos = lhs.m_bufData.m_pos;
+    m_bufData.m_size = lhs.m_bufData.m_size;
+    m_bufData.m_capacity = lhs.m_bufData.m_capacity;
+    m_bufData.m_dropped = lhs.m_bufData.m_dropped;
+
+    lhs.m_bufData.m_buf = nullptr;
+    lhs.m_bufData.m_pos = 0UL;
+    lhs.m_bufData.m_size = 0UL;
 }
 
 template <typename T, class Allocator>
 void CyclicBuffer<T, Allocator>::clearObj(CyclicBuffer &lhs)
 {
-    delete lhs.m_bufData.m_buf;
+    if (lhs.m_bufData.m_buf != nullptr)
+    {
+        lhs.destroyOldest(lhs.m_bufData.m_size);
+        AllocTraits::deallocate(lhs.allocator, lhs.m_bufData.m_buf, lhs.m_bufData.m_capacity);
+    }
     lhs.m_bufData.m_buf = nullptr;
 
     lhs.m_bufData.m_pos = 0UL;
     lhs.m_bufData.m_size = 0UL;
 }
 
+template <typename T, class Allocator>
+size_t CyclicBuffer<T, Allocator>::allocatedCapacity(const size_t &requested)
+{
+    // Mirrored storage can only be mapped in whole pages
+    if constexpr (MirroredAllocation<Allocator>)
+        return Allocator::roundCapacity(requested);
+    return requested;
+}
+
+template <typename T, class Allocator>
+void CyclicBuffer<T, Allocator>::relocate(const size_t &requested)
+{
+    const size_t capacity{allocatedCapacity(requested)};
+    T *buf{AllocTraits::allocate(allocator, capacity)};
+    size_t moved{0UL};
+
+    try
+    {
+        // Unrolls the wrap: both pieces go one after another into the new storage.
+        // Elements are copied instead of moved if their move ctor can throw,
+        // so the old storage stays intact on exception
+        for (const auto &span : getReadSpans())
+            for (T &elem : span)
+            {
+                AllocTraits::construct(allocator, buf + moved, std::move_if_noexcept(elem));
+                moved++;
+            }
+    }
+    catch (...)
+    {
+        for (size_t i{0UL}; i < moved; i++)
+            AllocTraits::destroy(allocator, buf + i);
+        AllocTraits::deallocate(allocator, buf, capacity);
+        throw;
+    }
+
+    // Seqlock makes a concurrent reader retry, but can't keep it from reading the freed storage:
+    // "pushBack()" and "resizeCapacity()" aren't allowed alongside "snapshot()"
+    beginWrite();
+    if (m_bufData.m_buf != nullptr)
+    {
+        destroyOldest(m_bufData.m_size);
+        AllocTraits::deallocate(allocator, m_bufData.m_buf, m_bufData.m_capacity);
+    }
+    m_bufData.m_buf = buf;
+    m_bufData.m_size = moved;
+    m_bufData.m_capacity = capacity;
+    m_bufData.m_pos = (moved == capacity) ? 0UL : moved;
+    endWrite();
+}
+
+template <typename T, class Allocator>
+void CyclicBuffer<T, Allocator>::destroyOldest(const size_t &count)
+{
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+        size_t left{count};
+        for (const auto &span : getReadSpans())
+            for (size_t i{0UL}; i < span.size() && left > 0UL; i++, left--)
+                AllocTraits::destroy(allocator, span.data() + i);
+    }
+}
+
+template <typename T, class Allocator>
+void CyclicBuffer<T, Allocator>::beginWrite()
+{
+    m_bufData.m_sequence.store(m_bufData.m_sequence.load(std::memory_order_relaxed) + 1UL, std::memory_order_relaxed);
+    // Readers must not see modified data without seeing the odd sequence number
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+template <typename T, class Allocator>
+void CyclicBuffer<T, Allocator>::endWrite()
+{
+    m_bufData.m_sequence.store(m_bufData.m_sequence.load(std::memory_order_relaxed) + 1UL, std::memory_order_release);
+}
+
 template <typename T, class Allocator>
 CyclicBuffer<T, Allocator>::CyclicBuffer()
 {
-    m_bufData.m_buf = allocator.allocate(m_kMaxSize);
+    m_bufData.m_capacity = allocatedCapacity(m_kMaxSize);
+    m_bufData.m_buf = AllocTraits::allocate(allocator, m_bufData.m_capacity);
     m_bufData.m_pos = 0UL;
     m_bufData.m_size = 0UL;
-    m_bufData.m_capacity = m_kMaxSize;
+    m_bufData.m_dropped = 0UL;
 }
 
 template <typename T, class Allocator>
 CyclicBuffer<T, Allocator>::CyclicBuffer(const size_t &size)
 {
-    m_bufData.m_buf = allocator.allocate(size);
+    m_bufData.m_capacity = allocatedCapacity(size);
+    m_bufData.m_buf = AllocTraits::allocate(allocator, m_bufData.m_capacity);
     m_bufData.m_pos = 0UL;
     m_bufData.m_size = 0UL;
-    m_bufData.m_capacity = size;
+    m_bufData.m_dropped = 0UL;
 }
 
 template <typename T, class Allocator>
@@ -55,8 +163,7 @@ CyclicBuffer<T, Allocator>::CyclicBuffer(const CyclicBuffer &obj)
 template <typename T, class Allocator>
 CyclicBuffer<T, Allocator>::CyclicBuffer(CyclicBuffer &&lhs)
 {
-    copyObj(lhs);
-    clearObj(lhs);
+    moveObj(lhs);
 }
 
 template <typename T, class Allocator>
@@ -64,6 +171,7 @@ CyclicBuffer<T, Allocator> &CyclicBuffer<T, Allocator>::operator=(const CyclicBu
 {
     if (this == &obj)
         return *this;
+    clearObj(*this);
     copyObj(obj);
     return *this;
 }
@@ -74,8 +182,7 @@ CyclicBuffer<T, Allocator> &CyclicBuffer<T, Allocator>::operator=(CyclicBuffer &
     if (this == &lhs)
         return *this;
     clearObj(*this);
-    copyObj(lhs);
-    clearObj(lhs);
+    moveObj(lhs);
     return *this;
 }
 
@@ -97,33 +204,74 @@ constexpr size_t CyclicBuffer<T, Allocator>::getCapacity() const
     return m_bufData.m_capacity;
 }
 
+template <typename T, class Allocator>
+constexpr size_t CyclicBuffer<T, Allocator>::getDroppedCount() const
+{
+    return m_bufData.m_dropped;
+}
+
 template <typename T, class Allocator>
 constexpr void CyclicBuffer<T, Allocator>::resizeCapacity(const size_t &capacity)
 {
-    if (capacity <= m_bufData.m_size)
+    if (capacity < m_bufData.m_size)
     {
         std::cerr
             << "Can't resize the capacity of cyclic buffer.\nCurrent size = "
             << m_bufData.m_size << "\nCurrent capacity = "
             << m_bufData.m_capacity << std::endl;
     }
-    else
-        m_bufData.m_capacity = capacity;
+    else if (capacity != m_bufData.m_capacity || m_bufData.m_buf == nullptr)
+        relocate(capacity);
 }
 
 template <typename T, class Allocator>
 constexpr void CyclicBuffer<T, Allocator>::insert(const T &data)
 {
     if (m_bufData.m_buf == nullptr)
-        m_bufData.m_buf = allocator.allocate(1UL);
+        m_bufData.m_buf = AllocTraits::allocate(allocator, m_bufData.m_capacity);
 
-    m_bufData.m_buf[m_bufData.m_pos++] = data;
+    beginWrite();
 
+    // When buffer is full the oldest element is overwritten
     if (m_bufData.m_size < m_bufData.m_capacity)
+    {
+        AllocTraits::construct(allocator, m_bufData.m_buf + m_bufData.m_pos, data);
         m_bufData.m_size++;
+    }
+    else
+    {
+        m_bufData.m_buf[m_bufData.m_pos] = data;
+        m_bufData.m_dropped++;
+    }
+
+    m_bufData.m_pos = (m_bufData.m_pos + 1UL == m_bufData.m_capacity) ? 0UL : m_bufData.m_pos + 1UL;
+    endWrite();
+}
+
+template <typename T, class Allocator>
+constexpr void CyclicBuffer<T, Allocator>::pushBack(const T &data)
+{
+    if (m_bufData.m_size == m_bufData.m_capacity || m_bufData.m_buf == nullptr)
+        relocate(std::max(m_bufData.m_capacity * m_kGrowthFactor, 1UL));
 
-    if (m_bufData.m_pos == m_bufData.m_capacity)
-        m_bufData.m_pos = 0UL;
+    beginWrite();
+    AllocTraits::construct(allocator, m_bufData.m_buf + m_bufData.m_pos, data);
+    m_bufData.m_size++;
+    m_bufData.m_pos = (m_bufData.m_pos + 1UL == m_bufData.m_capacity) ? 0UL : m_bufData.m_pos + 1UL;
+    endWrite();
+}
+
+template <typename T, class Allocator>
+constexpr void CyclicBuffer<T, Allocator>::pushBack(T &&data)
+{
+    if (m_bufData.m_size == m_bufData.m_capacity || m_bufData.m_buf == nullptr)
+        relocate(std::max(m_bufData.m_capacity * m_kGrowthFactor, 1UL));
+
+    beginWrite();
+    AllocTraits::construct(allocator, m_bufData.m_buf + m_bufData.m_pos, std::move(data));
+    m_bufData.m_size++;
+    m_bufData.m_pos = (m_bufData.m_pos + 1UL == m_bufData.m_capacity) ? 0UL : m_bufData.m_pos + 1UL;
+    endWrite();
 }
 
 template <typename T, class Allocator>
@@ -132,21 +280,134 @@ constexpr T &CyclicBuffer<T, Allocator>::getData(const size_t &pos) const
     return m_bufData.m_buf[pos];
 }
 
+template <typename T, class Allocator>
+constexpr std::array<std::span<T>, 2UL> CyclicBuffer<T, Allocator>::getReadSpans() const
+{
+    if (m_bufData.m_buf == nullptr || m_bufData.m_size == 0UL)
+        return {};
+
+    // Oldest element is located 'm_size' positions behind the write position
+    const size_t first{m_bufData.m_pos >= m_bufData.m_size
+                           ? m_bufData.m_pos - m_bufData.m_size
+                           : m_bufData.m_pos + m_bufData.m_capacity - m_bufData.m_size};
+
+    // Mirrored storage continues past its end, the whole region is one piece
+    if constexpr (MirroredAllocation<Allocator>)
+        return {std::span<T>(m_bufData.m_buf + first, m_bufData.m_size), std::span<T>()};
+
+    const size_t firstCount{std::min(m_bufData.m_size, m_bufData.m_capacity - first)};
+
+    return {std::span<T>(m_bufData.m_buf + first, firstCount),
+            std::span<T>(m_bufData.m_buf, m_bufData.m_size - firstCount)};
+}
+
+template <typename T, class Allocator>
+constexpr void CyclicBuffer<T, Allocator>::commitRead(const size_t &count)
+{
+    const size_t toRead{std::min(count, m_bufData.m_size)};
+
+    beginWrite();
+    destroyOldest(toRead);
+    m_bufData.m_size -= toRead;
+    endWrite();
+}
+
+template <typename T, class Allocator>
+constexpr std::array<std::span<T>, 2UL> CyclicBuffer<T, Allocator>::reserveWrite(const size_t &count)
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Reserved region is raw storage, only trivially copyable types can be written into it");
+
+    if (m_bufData.m_buf == nullptr)
+        return {};
+
+    const size_t toWrite{std::min(count, m_bufData.m_capacity - m_bufData.m_size)};
+
+    if constexpr (MirroredAllocation<Allocator>)
+        return {std::span<T>(m_bufData.m_buf + m_bufData.m_pos, toWrite), std::span<T>()};
+
+    const size_t firstCount{std::min(toWrite, m_bufData.m_capacity - m_bufData.m_pos)};
+
+    return {std::span<T>(m_bufData.m_buf + m_bufData.m_pos, firstCount),
+            std::span<T>(m_bufData.m_buf, toWrite - firstCount)};
+}
+
+template <typename T, class Allocator>
+constexpr void CyclicBuffer<T, Allocator>::commitWrite(const size_t &count)
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Reserved region is raw storage, only trivially copyable types can be written into it");
+
+    const size_t written{std::min(count, m_bufData.m_capacity - m_bufData.m_size)};
+    const size_t pos{m_bufData.m_pos + written};
+
+    beginWrite();
+    m_bufData.m_pos = (pos >= m_bufData.m_capacity) ? pos - m_bufData.m_capacity : pos;
+    m_bufData.m_size += written;
+    endWrite();
+}
+
+template <typename T, class Allocator>
+template <typename OutputIt>
+OutputIt CyclicBuffer<T, Allocator>::drain(OutputIt out)
+{
+    beginWrite();
+    for (const auto &span : getReadSpans())
+        out = std::move(span.begin(), span.end(), out);
+    destroyOldest(m_bufData.m_size);
+    m_bufData.m_size = 0UL;
+    endWrite();
+    return out;
+}
+
+template <typename T, class Allocator>
+std::vector<T> CyclicBuffer<T, Allocator>::snapshot() const
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Snapshot may copy an element while it's being overwritten, only trivially copyable types are allowed");
+
+    // Only writers that keep the storage in place ("insert()", "commitWrite()", "commitRead()", "drain()",
+    // "clear()") may run concurrently, the ones that reach "relocate()" free the storage being copied
+    std::vector<T> result;
+    result.reserve(m_bufData.m_capacity);
+
+    while (true)
+    {
+        const size_t sequence{m_bufData.m_sequence.load(std::memory_order_acquire)};
+        // Writer is in the middle of modification, try again
+        if (sequence & 1UL)
+            continue;
+
+        result.clear();
+        for (const auto &span : getReadSpans())
+            result.insert(result.end(), span.begin(), span.end());
+
+        // Copy is consistent only if no writer has started meanwhile
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_bufData.m_sequence.load(std::memory_order_relaxed) == sequence)
+            return result;
+    }
+}
+
 template <typename T, class Allocator>
 constexpr void CyclicBuffer<T, Allocator>::clear()
 {
-    clearObj(*this);
+    // Storage is kept, so the buffer can be filled again without reallocation
+    beginWrite();
+    destroyOldest(m_bufData.m_size);
+    m_bufData.m_pos = 0UL;
+    m_bufData.m_size = 0UL;
+    endWrite();
 }
 
 template <typename T, class Allocator>
 constexpr void CyclicBuffer<T, Allocator>::printBuffer() const
 {
-    if (m_bufData.m_buf != nullptr)
+    if (m_bufData.m_size != 0UL)
     {
-        for (size_t i{0UL}; i < getSize(); i++)
-        {
-            std::cout << getData(i) << '\t';
-        }
+        for (const auto &span : getReadSpans())
+            for (const T &elem : span)
+                std::cout << elem << '\t';
         std::endl(std::cout);
     }
     else
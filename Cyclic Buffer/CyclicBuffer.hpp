@@ -1,22 +1,46 @@
 #ifndef __CYCLICBUFFER_HPP__
 #define __CYCLICBUFFER_HPP__
 
+#include <array>
+#include <atomic>
 #include <iostream>
 #include <memory>
+#include <span>
+#include <vector>
+
+// Allocation policy that maps storage twice back-to-back (see 'MirroredAllocator.hpp')
+template <class Allocator>
+concept MirroredAllocation = requires { requires Allocator::is_mirrored; };
 
 template <typename T, class Allocator = std::allocator<T>>
 class CyclicBuffer
 {
 private:
+    using AllocTraits = std::allocator_traits<Allocator>;
+
     static constexpr size_t m_kMaxSize{255UL};
+    static constexpr size_t m_kGrowthFactor{2UL};
     struct BufData;
     BufData m_bufData;
     Allocator allocator;
 
 protected:
     void copyObj(const CyclicBuffer &);
+    void moveObj(CyclicBuffer &);
     void clearObj(CyclicBuffer &);
 
+    // Capacity the storage can really be allocated with: mirrored storage is rounded up to whole pages
+    static size_t allocatedCapacity(const size_t &);
+    // Moves elements to a new storage of specified capacity, the oldest element goes to index 0.
+    // Old storage is freed, so it mustn't run while "snapshot()" is copying in another thread
+    void relocate(const size_t &);
+    // Destroys specified count of the oldest elements
+    void destroyOldest(const size_t &);
+
+    // Seqlock: sequence number is odd while the buffer is being modified
+    void beginWrite();
+    void endWrite();
+
 public:
     explicit CyclicBuffer();
     explicit CyclicBuffer(const size_t &);
@@ -28,10 +52,23 @@ public:
 
     constexpr size_t getSize() const;
     constexpr size_t getCapacity() const;
+    constexpr size_t getDroppedCount() const;
     constexpr void resizeCapacity(const size_t &);
 
     constexpr void insert(const T &);
+    constexpr void pushBack(const T &);
+    constexpr void pushBack(T &&);
     constexpr T &getData(const size_t &) const;
+
+    constexpr std::array<std::span<T>, 2UL> getReadSpans() const;
+    constexpr void commitRead(const size_t &);
+    constexpr std::array<std::span<T>, 2UL> reserveWrite(const size_t &);
+    constexpr void commitWrite(const size_t &);
+
+    template <typename OutputIt>
+    OutputIt drain(OutputIt);
+    std::vector<T> snapshot() const;
+
     constexpr void clear();
     constexpr void printBuffer() const;
 };
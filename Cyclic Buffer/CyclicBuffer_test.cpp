@@ -0,0 +1,186 @@
+#include <string>
+#include <thread>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "CyclicBuffer.hpp"
+#include "CyclicBuffer.cpp"
+#include "MirroredAllocator.hpp"
+#include "MirroredAllocator.cpp"
+
+// Converts spans of the cyclic buffer to 'iovec' array for "readv()"/"writev()"
+static int toIovec(const std::array<std::span<char>, 2UL> &spans, iovec *iov)
+{
+    int count{0};
+    for (const auto &span : spans)
+        if (!span.empty())
+            iov[count++] = {span.data(), span.size()};
+    return count;
+}
+
+// Passes 'message' through: pipe -> readv() -> cyclic buffer -> writev() -> pipe.
+// Chunk size isn't a divisor of capacity, so regions cross the end of storage.
+// Returns max count of pieces that was needed for a single "readv()"/"writev()".
+template <class Buffer>
+static int passThroughPipe(Buffer &cb, const std::string &message, const size_t &chunkSize, std::string &received)
+{
+    int in[2], out[2];
+    if (pipe(in) != 0 || pipe(out) != 0)
+    {
+        std::cerr << "Can't create pipes" << std::endl;
+        return -1;
+    }
+
+    int maxPieces{0};
+    std::string chunk;
+    for (size_t offset{0UL}; offset < message.size(); offset += chunkSize)
+    {
+        const size_t size{std::min(chunkSize, message.size() - offset)};
+        if (write(in[1], message.data() + offset, size) != static_cast<ssize_t>(size))
+            return -1;
+
+        // pipe -> cyclic buffer, straight into the reserved region
+        iovec iov[2];
+        int iovCount{toIovec(cb.reserveWrite(size), iov)};
+        maxPieces = std::max(maxPieces, iovCount);
+        const ssize_t got{readv(in[0], iov, iovCount)};
+        if (got != static_cast<ssize_t>(size))
+        {
+            std::cerr << "readv() read " << got << " bytes instead of " << size << std::endl;
+            return -1;
+        }
+        cb.commitWrite(static_cast<size_t>(got));
+
+        // cyclic buffer -> pipe, straight from the readable region
+        iovCount = toIovec(cb.getReadSpans(), iov);
+        maxPieces = std::max(maxPieces, iovCount);
+        const ssize_t sent{writev(out[1], iov, iovCount)};
+        if (sent != got)
+        {
+            std::cerr << "writev() wrote " << sent << " bytes instead of " << got << std::endl;
+            return -1;
+        }
+        cb.commitRead(static_cast<size_t>(sent));
+
+        chunk.resize(size);
+        if (read(out[0], chunk.data(), size) != static_cast<ssize_t>(size))
+            return -1;
+        received += chunk;
+    }
+
+    close(in[0]);
+    close(in[1]);
+    close(out[0]);
+    close(out[1]);
+    return maxPieces;
+}
+
+// Overwrite-oldest semantics: drain order, dropped counter and snapshots taken during inserts
+static bool checkTelemetry()
+{
+    CyclicBuffer<size_t> cb(8UL);
+    for (size_t i{0UL}; i < 20UL; i++)
+        cb.insert(i);
+
+    std::vector<size_t> drained;
+    cb.drain(std::back_inserter(drained));
+    if (drained != std::vector<size_t>{12UL, 13UL, 14UL, 15UL, 16UL, 17UL, 18UL, 19UL} ||
+        cb.getDroppedCount() != 12UL || cb.getSize() != 0UL)
+    {
+        std::cerr << "Failed: drain() returned wrong elements or dropped count is wrong" << std::endl;
+        return false;
+    }
+
+    // Every consistent snapshot is a run of consecutive values, a torn one isn't
+    std::atomic<bool> done{false};
+    std::thread writer([&cb, &done]()
+                       {
+        for (size_t i{0UL}; i < 200'000UL; i++)
+            cb.insert(i);
+        done.store(true); });
+
+    bool consistent{true};
+    while (!done.load())
+    {
+        const std::vector<size_t> snapshot{cb.snapshot()};
+        for (size_t i{1UL}; i < snapshot.size(); i++)
+            consistent = consistent && snapshot[i] == snapshot[i - 1UL] + 1UL;
+    }
+    writer.join();
+
+    if (!consistent)
+        std::cerr << "Failed: snapshot() returned torn data" << std::endl;
+    return consistent;
+}
+
+// Growth: wrapped contents keep logical order after "pushBack()"/"resizeCapacity()" reallocate,
+// copies are deep and non-trivial elements survive relocation
+static bool checkGrowth()
+{
+    CyclicBuffer<std::string> cb(4UL);
+    for (size_t i{0UL}; i < 6UL; i++)
+        cb.insert(std::to_string(i));
+    cb.commitRead(1UL);
+
+    // Contents are wrapped now: "3" is at the end of storage, "4" and "5" at the beginning
+    for (size_t i{6UL}; i < 100UL; i++)
+        cb.pushBack(std::to_string(i));
+    cb.resizeCapacity(cb.getSize());
+
+    const CyclicBuffer<std::string> copy(cb);
+    cb.clear();
+
+    std::vector<std::string> drained;
+    CyclicBuffer<std::string>(copy).drain(std::back_inserter(drained));
+    bool ordered{drained.size() == 97UL && copy.getCapacity() == 97UL};
+    for (size_t i{0UL}; ordered && i < drained.size(); i++)
+        ordered = drained[i] == std::to_string(i + 3UL);
+
+    if (!ordered || cb.getSize() != 0UL || copy.getSize() != 97UL)
+        std::cerr << "Failed: growth lost the logical order of elements" << std::endl;
+    return ordered && cb.getSize() == 0UL && copy.getSize() == 97UL;
+}
+
+int main()
+{
+    if (!checkGrowth())
+        return EXIT_FAILURE;
+
+    if (!checkTelemetry())
+        return EXIT_FAILURE;
+
+    std::string message;
+    for (size_t i{0UL}; message.size() < 20'000UL; i++)
+        message += "The quick brown fox jumps over the lazy dog #" + std::to_string(i) + '\n';
+
+    // Ordinary storage: wrapped regions have to be split into two pieces
+    CyclicBuffer<char> cb(16UL);
+    std::string received;
+    const int pieces{passThroughPipe(cb, message, 7UL, received)};
+    if (pieces != 2 || received != message || cb.getSize() != 0UL)
+    {
+        std::cerr << "Failed: data passed through the cyclic buffer differs" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Mirrored storage is mapped in whole pages, ctors round the capacity up
+    const CyclicBuffer<std::byte, MirroredAllocator<std::byte>> defaultMirrored;
+    if (defaultMirrored.getCapacity() != MirroredAllocator<std::byte>::roundCapacity(1UL))
+    {
+        std::cerr << "Failed: capacity of the mirrored cyclic buffer isn't rounded to pages" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Mirrored storage: any region is a single piece
+    CyclicBuffer<char, MirroredAllocator<char>> mirrored(1UL);
+    std::string receivedMirrored;
+    const int mirroredPieces{passThroughPipe(mirrored, message, 1000UL, receivedMirrored)};
+    if (mirroredPieces != 1 || receivedMirrored != message || mirrored.getSize() != 0UL)
+    {
+        std::cerr << "Failed: data passed through the mirrored cyclic buffer differs" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Passed: " << received.size() << " bytes through readv()/writev()" << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,61 @@
+#include <new>
+#include <numeric>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "MirroredAllocator.hpp"
+
+template <typename T>
+T *MirroredAllocator<T>::allocate(const size_t &n)
+{
+    const size_t bytes{n * sizeof(T)};
+    const size_t pageSize{static_cast<size_t>(sysconf(_SC_PAGESIZE))};
+
+    if (bytes == 0UL || bytes % pageSize != 0UL)
+        throw std::invalid_argument("MirroredAllocator: storage size has to be a multiple of the page size");
+
+    const int fd{memfd_create("CyclicBuffer", MFD_CLOEXEC)};
+    if (fd == -1)
+        throw std::bad_alloc();
+    if (ftruncate(fd, static_cast<off_t>(bytes)) == -1)
+    {
+        close(fd);
+        throw std::bad_alloc();
+    }
+
+    // Reserve address space for both copies first, then map the same file into each half
+    auto *base{static_cast<char *>(mmap(nullptr, 2UL * bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0))};
+    if (base == MAP_FAILED)
+    {
+        close(fd);
+        throw std::bad_alloc();
+    }
+
+    if (mmap(base, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+        mmap(base + bytes, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+    {
+        munmap(base, 2UL * bytes);
+        close(fd);
+        throw std::bad_alloc();
+    }
+
+    // Mappings keep the memory alive, descriptor isn't needed anymore
+    close(fd);
+    return reinterpret_cast<T *>(base);
+}
+
+template <typename T>
+void MirroredAllocator<T>::deallocate(T *p, const size_t &n) noexcept
+{
+    munmap(p, 2UL * n * sizeof(T));
+}
+
+template <typename T>
+size_t MirroredAllocator<T>::roundCapacity(const size_t &n)
+{
+    const size_t pageSize{static_cast<size_t>(sysconf(_SC_PAGESIZE))};
+    // Smallest count of elements that fills whole pages
+    const size_t step{std::lcm(pageSize, sizeof(T)) / sizeof(T)};
+    return (n == 0UL ? 1UL : (n + step - 1UL) / step) * step;
+}
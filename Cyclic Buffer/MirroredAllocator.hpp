@@ -0,0 +1,37 @@
+#ifndef __MIRROREDALLOCATOR_HPP__
+#define __MIRROREDALLOCATOR_HPP__
+
+#include <cstddef>
+
+// Linux-only allocation policy for 'CyclicBuffer': storage of 'n' elements is an anonymous
+// 'memfd' mapped twice back-to-back, so element 'n + i' is the same memory as element 'i'.
+// Any region of the buffer, even crossing the end of storage, is one contiguous pointer range.
+// Size of the storage (n * sizeof(T)) has to be a multiple of the page size, see "roundCapacity()".
+template <typename T>
+class MirroredAllocator
+{
+public:
+    using value_type = T;
+
+    // Tells 'CyclicBuffer' that wrapped regions don't have to be split
+    static constexpr bool is_mirrored{true};
+
+    MirroredAllocator() noexcept = default;
+
+    template <typename U>
+    MirroredAllocator(const MirroredAllocator<U> &) noexcept {}
+
+    T *allocate(const size_t &);
+    void deallocate(T *, const size_t &) noexcept;
+
+    // Rounds count of elements up, so that storage occupies whole pages
+    static size_t roundCapacity(const size_t &);
+};
+
+template <typename T, typename U>
+constexpr bool operator==(const MirroredAllocator<T> &, const MirroredAllocator<U> &) noexcept { return true; }
+
+template <typename T, typename U>
+constexpr bool operator!=(const MirroredAllocator<T> &, const MirroredAllocator<U> &) noexcept { return false; }
+
+#endif // __MIRROREDALLOCATOR_HPP__
@@ -0,0 +1,158 @@
+#include "SPSCCyclicBuffer.hpp"
+
+template <typename T, class Allocator>
+constexpr size_t SPSCCyclicBuffer<T, Allocator>::nextIndex(const size_t &index) const noexcept
+{
+    return (index + 1UL == m_slots) ? 0UL : index + 1UL;
+}
+
+template <typename T, class Allocator>
+constexpr size_t SPSCCyclicBuffer<T, Allocator>::distance(const size_t &from, const size_t &to) const noexcept
+{
+    return (to >= from) ? to - from : m_slots - from + to;
+}
+
+template <typename T, class Allocator>
+SPSCCyclicBuffer<T, Allocator>::SPSCCyclicBuffer() : SPSCCyclicBuffer(m_kMaxSize) {}
+
+template <typename T, class Allocator>
+SPSCCyclicBuffer<T, Allocator>::SPSCCyclicBuffer(const size_t &capacity)
+    : m_head(0UL), m_cachedTail(0UL), m_tail(0UL), m_cachedHead(0UL), m_slots(capacity + 1UL)
+{
+    m_buf = AllocTraits::allocate(allocator, m_slots);
+}
+
+template <typename T, class Allocator>
+SPSCCyclicBuffer<T, Allocator>::~SPSCCyclicBuffer()
+{
+    const size_t tail{m_tail.load(std::memory_order_acquire)};
+    for (size_t i{m_head.load(std::memory_order_relaxed)}; i != tail; i = nextIndex(i))
+        AllocTraits::destroy(allocator, m_buf + i);
+    AllocTraits::deallocate(allocator, m_buf, m_slots);
+}
+
+template <typename T, class Allocator>
+size_t SPSCCyclicBuffer<T, Allocator>::getSize() const
+{
+    const size_t head{m_head.load(std::memory_order_acquire)};
+    return distance(head, m_tail.load(std::memory_order_acquire));
+}
+
+template <typename T, class Allocator>
+constexpr size_t SPSCCyclicBuffer<T, Allocator>::getCapacity() const
+{
+    return m_slots - 1UL;
+}
+
+template <typename T, class Allocator>
+bool SPSCCyclicBuffer<T, Allocator>::empty() const
+{
+    return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+}
+
+template <typename T, class Allocator>
+bool SPSCCyclicBuffer<T, Allocator>::try_push(const T &data)
+{
+    const size_t tail{m_tail.load(std::memory_order_relaxed)};
+    const size_t next{nextIndex(tail)};
+
+    if (next == m_cachedHead)
+    {
+        m_cachedHead = m_head.load(std::memory_order_acquire);
+        if (next == m_cachedHead)
+            return false;
+    }
+
+    AllocTraits::construct(allocator, m_buf + tail, data);
+    m_tail.store(next, std::memory_order_release);
+    return true;
+}
+
+template <typename T, class Allocator>
+bool SPSCCyclicBuffer<T, Allocator>::try_push(T &&data)
+{
+    const size_t tail{m_tail.load(std::memory_order_relaxed)};
+    const size_t next{nextIndex(tail)};
+
+    if (next == m_cachedHead)
+    {
+        m_cachedHead = m_head.load(std::memory_order_acquire);
+        if (next == m_cachedHead)
+            return false;
+    }
+
+    AllocTraits::construct(allocator, m_buf + tail, std::move(data));
+    m_tail.store(next, std::memory_order_release);
+    return true;
+}
+
+template <typename T, class Allocator>
+size_t SPSCCyclicBuffer<T, Allocator>::push_n(const T *data, const size_t &count)
+{
+    const size_t tail{m_tail.load(std::memory_order_relaxed)};
+    size_t free{m_slots - 1UL - distance(m_cachedHead, tail)};
+
+    if (free < count)
+    {
+        m_cachedHead = m_head.load(std::memory_order_acquire);
+        free = m_slots - 1UL - distance(m_cachedHead, tail);
+    }
+
+    const size_t toPush{count < free ? count : free};
+    size_t index{tail};
+    for (size_t i{0UL}; i < toPush; i++)
+    {
+        AllocTraits::construct(allocator, m_buf + index, data[i]);
+        index = nextIndex(index);
+    }
+
+    // Publish the whole batch with a single release store
+    if (toPush != 0UL)
+        m_tail.store(index, std::memory_order_release);
+    return toPush;
+}
+
+template <typename T, class Allocator>
+bool SPSCCyclicBuffer<T, Allocator>::try_pop(T &data)
+{
+    const size_t head{m_head.load(std::memory_order_relaxed)};
+
+    if (head == m_cachedTail)
+    {
+        m_cachedTail = m_tail.load(std::memory_order_acquire);
+        if (head == m_cachedTail)
+            return false;
+    }
+
+    data = std::move(m_buf[head]);
+    AllocTraits::destroy(allocator, m_buf + head);
+    m_head.store(nextIndex(head), std::memory_order_release);
+    return true;
+}
+
+template <typename T, class Allocator>
+size_t SPSCCyclicBuffer<T, Allocator>::pop_n(T *data, const size_t &count)
+{
+    const size_t head{m_head.load(std::memory_order_relaxed)};
+    size_t available{distance(head, m_cachedTail)};
+
+    if (available < count)
+    {
+        m_cachedTail = m_tail.load(std::memory_order_acquire);
+        available = distance(head, m_cachedTail);
+    }
+
+    const size_t toPop{count < available ? count : available};
+    size_t index{head};
+    for (size_t i{0UL}; i < toPop; i++)
+    {
+        data[i] = std::move(m_buf[index]);
+        AllocTraits::destroy(allocator, m_buf + index);
+        index = nextIndex(index);
+    }
+
+    // Hand the freed slots back to the producer in one go
+    if (toPop != 0UL)
+        m_head.store(index, std::memory_order_release);
+    return toPop;
+}
@@ -0,0 +1,58 @@
+#ifndef __SPSCCYCLICBUFFER_HPP__
+#define __SPSCCYCLICBUFFER_HPP__
+
+#include <atomic>
+#include <memory>
+
+// Lock-free cyclic buffer for exactly one producer thread and one consumer thread.
+// Producer owns 'm_tail', consumer owns 'm_head', each side keeps a cached copy
+// of the other index so the shared cache line is touched only when really needed.
+template <typename T, class Allocator = std::allocator<T>>
+class SPSCCyclicBuffer
+{
+private:
+    using AllocTraits = std::allocator_traits<Allocator>;
+
+    static constexpr size_t m_kMaxSize{255UL};
+    static constexpr size_t m_kCacheLineSize{64UL};
+
+    // Consumer side: next slot to read and the last tail seen by the consumer
+    alignas(m_kCacheLineSize) std::atomic<size_t> m_head;
+    size_t m_cachedTail;
+
+    // Producer side: next slot to write and the last head seen by the producer
+    alignas(m_kCacheLineSize) std::atomic<size_t> m_tail;
+    size_t m_cachedHead;
+
+    // Read-only after construction. One slot is always kept free to tell full from empty
+    alignas(m_kCacheLineSize) T *m_buf;
+    size_t m_slots;
+    Allocator allocator;
+
+    constexpr size_t nextIndex(const size_t &) const noexcept;
+    constexpr size_t distance(const size_t &, const size_t &) const noexcept;
+
+public:
+    explicit SPSCCyclicBuffer();
+    explicit SPSCCyclicBuffer(const size_t &);
+    SPSCCyclicBuffer(const SPSCCyclicBuffer &) = delete;
+    SPSCCyclicBuffer(SPSCCyclicBuffer &&) = delete;
+    SPSCCyclicBuffer &operator=(const SPSCCyclicBuffer &) = delete;
+    SPSCCyclicBuffer &operator=(SPSCCyclicBuffer &&) = delete;
+    virtual ~SPSCCyclicBuffer();
+
+    size_t getSize() const;
+    constexpr size_t getCapacity() const;
+    bool empty() const;
+
+    // Producer thread only
+    bool try_push(const T &);
+    bool try_push(T &&);
+    size_t push_n(const T *, const size_t &);
+
+    // Consumer thread only
+    bool try_pop(T &);
+    size_t pop_n(T *, const size_t &);
+};
+
+#endif // __SPSCCYCLICBUFFER_HPP__
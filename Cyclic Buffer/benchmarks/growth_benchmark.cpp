@@ -0,0 +1,60 @@
+#include <chrono>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#include "../CyclicBuffer.hpp"
+#include "../CyclicBuffer.cpp"
+
+// Appends 'count' elements one by one starting from an almost empty container.
+// Returns nanoseconds per element.
+template <class Push>
+double run(const size_t &count, Push push)
+{
+    const auto start{std::chrono::steady_clock::now()};
+    for (size_t i{0UL}; i < count; i++)
+        push(i);
+    const std::chrono::duration<double, std::nano> elapsed{std::chrono::steady_clock::now() - start};
+    return elapsed.count() / static_cast<double>(count);
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t count{argc > 1 ? std::stoul(argv[1]) : 10'000'000UL};
+
+    std::cout << "Elements: " << count << ", initial capacity: 16" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    {
+        CyclicBuffer<size_t> cb(count);
+        const double ns{run(count, [&cb](const size_t &i)
+                            { cb.insert(i); })};
+        std::cout << "insert(), preallocated:     " << ns << " ns/element" << std::endl;
+    }
+    {
+        CyclicBuffer<size_t> cb(16UL);
+        const double ns{run(count, [&cb](const size_t &i)
+                            { cb.pushBack(i); })};
+        std::cout << "pushBack(), growing:        " << ns << " ns/element, capacity " << cb.getCapacity() << std::endl;
+    }
+    {
+        // Old way: grow by a fixed step every time the buffer is full
+        CyclicBuffer<size_t> cb(16UL);
+        const size_t elements{std::min(count, 200'000UL)};
+        const double ns{run(elements, [&cb](const size_t &i)
+                            {
+            if (cb.getSize() == cb.getCapacity())
+                cb.resizeCapacity(cb.getCapacity() + 16UL);
+            cb.insert(i); })};
+        std::cout << "resizeCapacity(+16), first " << elements << ": " << ns << " ns/element" << std::endl;
+    }
+    {
+        std::vector<size_t> vec;
+        vec.reserve(16UL);
+        const double ns{run(count, [&vec](const size_t &i)
+                            { vec.push_back(i); })};
+        std::cout << "std::vector::push_back():   " << ns << " ns/element" << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
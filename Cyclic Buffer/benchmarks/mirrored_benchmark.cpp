@@ -0,0 +1,70 @@
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#include "../CyclicBuffer.hpp"
+#include "../CyclicBuffer.cpp"
+#include "../MirroredAllocator.hpp"
+#include "../MirroredAllocator.cpp"
+
+// Pushes messages of the same size through the buffer: copy in via "reserveWrite()",
+// copy out via "getReadSpans()". Capacity isn't a multiple of the message size,
+// so messages regularly straddle the end of storage.
+template <class Buffer>
+double run(Buffer &cb, const size_t &messageSize, const size_t &messages, size_t &straddled)
+{
+    std::vector<std::byte> in(messageSize, std::byte{42}), out(messageSize);
+    straddled = 0UL;
+
+    const auto start{std::chrono::steady_clock::now()};
+    for (size_t i{0UL}; i < messages; i++)
+    {
+        size_t copied{0UL};
+        for (const auto &span : cb.reserveWrite(messageSize))
+        {
+            std::memcpy(span.data(), in.data() + copied, span.size());
+            copied += span.size();
+        }
+        cb.commitWrite(copied);
+
+        const auto spans{cb.getReadSpans()};
+        straddled += !spans[1].empty();
+        copied = 0UL;
+        for (const auto &span : spans)
+        {
+            std::memcpy(out.data() + copied, span.data(), span.size());
+            copied += span.size();
+        }
+        cb.commitRead(copied);
+    }
+    const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+
+    return static_cast<double>(messageSize * messages) / elapsed.count() / 1e9;
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t messages{argc > 1 ? std::stoul(argv[1]) : 2'000'000UL};
+    const size_t capacity{MirroredAllocator<std::byte>::roundCapacity(64UL * 1024UL)};
+
+    std::cout << "Messages: " << messages << ", capacity: " << capacity << " bytes" << std::endl;
+    std::cout << std::setw(14) << "message size" << std::setw(16) << "split, GB/s"
+              << std::setw(16) << "mirrored, GB/s" << std::setw(14) << "straddled" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    for (size_t messageSize : {64UL, 1500UL, 4000UL, 9000UL, 30000UL})
+    {
+        size_t straddled{0UL}, unused{0UL};
+        CyclicBuffer<std::byte> split(capacity);
+        CyclicBuffer<std::byte, MirroredAllocator<std::byte>> mirrored(capacity);
+
+        const double splitSpeed{run(split, messageSize, messages, straddled)};
+        const double mirroredSpeed{run(mirrored, messageSize, messages, unused)};
+        std::cout << std::setw(14) << messageSize << std::setw(16) << splitSpeed
+                  << std::setw(16) << mirroredSpeed << std::setw(14) << straddled << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../SPSCCyclicBuffer.hpp"
+#include "../SPSCCyclicBuffer.cpp"
+
+// Baseline: the same ring guarded by a single mutex, as it was used before
+template <typename T>
+class MutexCyclicBuffer
+{
+private:
+    std::mutex m_mutex;
+    std::vector<T> m_buf;
+    size_t m_head{0UL};
+    size_t m_size{0UL};
+
+public:
+    explicit MutexCyclicBuffer(const size_t &capacity) : m_buf(capacity) {}
+
+    bool try_push(const T &data)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_size == m_buf.size())
+            return false;
+        m_buf[(m_head + m_size++) % m_buf.size()] = data;
+        return true;
+    }
+
+    bool try_pop(T &data)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_size == 0UL)
+            return false;
+        data = m_buf[m_head];
+        m_head = (m_head + 1UL) % m_buf.size();
+        m_size--;
+        return true;
+    }
+
+    size_t push_n(const T *data, const size_t &count)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        size_t pushed{0UL};
+        for (; pushed < count && m_size < m_buf.size(); pushed++)
+            m_buf[(m_head + m_size++) % m_buf.size()] = data[pushed];
+        return pushed;
+    }
+
+    size_t pop_n(T *data, const size_t &count)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        size_t popped{0UL};
+        for (; popped < count && m_size > 0UL; popped++, m_size--)
+        {
+            data[popped] = m_buf[m_head];
+            m_head = (m_head + 1UL) % m_buf.size();
+        }
+        return popped;
+    }
+};
+
+template <typename Buffer>
+double runSingle(Buffer &buffer, const size_t &count)
+{
+    const auto start{std::chrono::steady_clock::now()};
+
+    std::thread producer([&buffer, count]()
+                         {
+        for (size_t i{0UL}; i < count; i++)
+            while (!buffer.try_push(i))
+                std::this_thread::yield(); });
+
+    size_t value{0UL}, checksum{0UL};
+    for (size_t i{0UL}; i < count; i++)
+    {
+        while (!buffer.try_pop(value))
+            std::this_thread::yield();
+        checksum += value;
+    }
+    producer.join();
+
+    const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+    if (checksum != count * (count - 1UL) / 2UL)
+        std::cerr << "Checksum mismatch" << std::endl;
+    return count / elapsed.count();
+}
+
+template <typename Buffer>
+double runBatched(Buffer &buffer, const size_t &count, const size_t &batch)
+{
+    const auto start{std::chrono::steady_clock::now()};
+
+    std::thread producer([&buffer, count, batch]()
+                         {
+        std::vector<size_t> values(batch);
+        for (size_t sent{0UL}; sent < count;)
+        {
+            const size_t n{std::min(batch, count - sent)};
+            for (size_t i{0UL}; i < n; i++)
+                values[i] = sent + i;
+            size_t done{0UL};
+            while ((done += buffer.push_n(values.data() + done, n - done)) < n)
+                std::this_thread::yield();
+            sent += n;
+        } });
+
+    std::vector<size_t> values(batch);
+    size_t checksum{0UL};
+    for (size_t received{0UL}; received < count;)
+    {
+        const size_t n{buffer.pop_n(values.data(), batch)};
+        if (n == 0UL)
+            std::this_thread::yield();
+        for (size_t i{0UL}; i < n; i++)
+            checksum += values[i];
+        received += n;
+    }
+    producer.join();
+
+    const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+    if (checksum != count * (count - 1UL) / 2UL)
+        std::cerr << "Checksum mismatch" << std::endl;
+    return count / elapsed.count();
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t count{argc > 1 ? std::stoul(argv[1]) : 10'000'000UL};
+    const size_t capacity{argc > 2 ? std::stoul(argv[2]) : 4096UL};
+    const size_t batch{64UL};
+
+    std::cout << "Items: " << count << ", capacity: " << capacity << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    {
+        MutexCyclicBuffer<size_t> buffer(capacity);
+        std::cout << "mutex  try_push/try_pop: " << runSingle(buffer, count) / 1e6 << " Mops/s" << std::endl;
+    }
+    {
+        SPSCCyclicBuffer<size_t> buffer(capacity);
+        std::cout << "spsc   try_push/try_pop: " << runSingle(buffer, count) / 1e6 << " Mops/s" << std::endl;
+    }
+    {
+        MutexCyclicBuffer<size_t> buffer(capacity);
+        std::cout << "mutex  push_n/pop_n(" << batch << "): " << runBatched(buffer, count, batch) / 1e6 << " Mops/s" << std::endl;
+    }
+    {
+        SPSCCyclicBuffer<size_t> buffer(capacity);
+        std::cout << "spsc   push_n/pop_n(" << batch << "): " << runBatched(buffer, count, batch) / 1e6 << " Mops/s" << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,254 @@
+#include <iostream>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "include/dictionary.hpp"
+#include "include/dictionary_impl.hpp"
+
+// Compares every key of 'expected' and the whole range of keys around them with the dictionary
+template <class Dict>
+static bool sameContents(Dict const &dict, std::map<int, std::string> const &expected, int maxKey)
+{
+    if (dict.size() != expected.size() || dict.empty() != expected.empty())
+        return false;
+    for (int key{-1}; key <= maxKey + 1; key++)
+    {
+        const auto it{expected.find(key)};
+        if (dict.is_set(key) != (it != expected.end()))
+            return false;
+        if (it != expected.end() && dict.at(key) != it->second)
+            return false;
+    }
+    return expected.empty() || (dict.min() == expected.begin()->second && dict.max() == expected.rbegin()->second);
+}
+
+// "is_set()" used to return the inverted result
+static bool checkIsSet()
+{
+    Dictionary<int, std::string> dict(4, "four");
+    const bool passed{dict.is_set(4) && !dict.is_set(5) && !Dictionary<int, std::string>().is_set(4)};
+    if (!passed)
+        std::cerr << "Failed: is_set() doesn't tell if the key exists" << std::endl;
+    return passed;
+}
+
+// Ascending insertion is the worst case for a plain BST: AVL rotations have to keep the tree
+// perfectly balanced, so the root is the middle key
+static bool checkRebalance()
+{
+    Dictionary<int, std::string> dict;
+    for (int key{1}; key <= 1023; key++)
+        dict.insert(key, std::to_string(key));
+
+    if (dict.get_key() != 512 || dict.size() != 1023ul)
+    {
+        std::cerr << "Failed: ascending insertion left the tree unbalanced, root is " << dict.get_key() << std::endl;
+        return false;
+    }
+
+    // Descending removal of the upper half is the mirrored case
+    for (int key{1023}; key > 511; key--)
+        dict.erase(key);
+    if (dict.get_key() != 256 || dict.size() != 511ul)
+    {
+        std::cerr << "Failed: removal left the tree unbalanced, root is " << dict.get_key() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Random inserts, overwrites and erases against "std::map"
+static bool checkInsertErase()
+{
+    constexpr int kMaxKey{500};
+    std::mt19937 gen(42u);
+    std::uniform_int_distribution<int> keys(0, kMaxKey);
+
+    Dictionary<int, std::string> dict;
+    std::map<int, std::string> expected;
+    for (int i{0}; i < 20'000; i++)
+    {
+        const int key{keys(gen)};
+        if (gen() % 3u)
+        {
+            dict.insert(key, std::to_string(i));
+            expected[key] = std::to_string(i);
+        }
+        else
+        {
+            dict.erase(key);
+            expected.erase(key);
+        }
+
+        if (i % 1000 == 0 && !sameContents(dict, expected, kMaxKey))
+        {
+            std::cerr << "Failed: contents differ from std::map after " << i << " operations" << std::endl;
+            return false;
+        }
+    }
+
+    dict.clear();
+    if (!dict.empty() || dict.size() != 0ul || dict.is_set(expected.begin()->first))
+    {
+        std::cerr << "Failed: clear() didn't erase all elements" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Copies are deep, moved-from dictionaries are empty, and "size()" follows all of them
+static bool checkCopyMove()
+{
+    std::map<int, std::string> expected;
+    Dictionary<int, std::string> dict;
+    for (int key{0}; key < 100; key++)
+    {
+        dict.insert(key, std::to_string(key));
+        expected[key] = std::to_string(key);
+    }
+
+    Dictionary<int, std::string> copy(dict);
+    dict.erase(0);
+    dict.set(1, "changed");
+    bool passed{sameContents(copy, expected, 100)};
+
+    Dictionary<int, std::string> assigned(7, "seven");
+    assigned = copy;
+    passed = passed && sameContents(assigned, expected, 100);
+
+    Dictionary<int, std::string> moved(std::move(copy));
+    passed = passed && sameContents(moved, expected, 100) && copy.empty() && copy.size() == 0ul;
+
+    Dictionary<int, std::string> moveAssigned(7, "seven");
+    moveAssigned = std::move(moved);
+    passed = passed && sameContents(moveAssigned, expected, 100) && moved.empty() && !moved.is_set(50);
+
+    // Moved-from dictionary stays usable
+    moved.insert(3, "three");
+    passed = passed && moved.size() == 1ul && moved.at(3) == "three";
+
+    if (!passed)
+        std::cerr << "Failed: copy or move doesn't preserve the contents" << std::endl;
+    return passed;
+}
+
+/// @brief Stateful allocator that doesn't propagate: instances with different tags can't free each other's memory
+template <typename T>
+struct TaggedAllocator : std::allocator<T>
+{
+    using propagate_on_container_move_assignment = std::false_type;
+    using is_always_equal = std::false_type;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = TaggedAllocator<U>;
+    };
+
+    int tag{};
+
+    TaggedAllocator(int t = 0) noexcept : tag(t) {}
+    template <typename U>
+    TaggedAllocator(TaggedAllocator<U> const &other) noexcept : tag(other.tag) {}
+
+    template <typename U>
+    bool operator==(TaggedAllocator<U> const &other) const noexcept { return tag == other.tag; }
+};
+
+// Move assignment between unequal allocators copies the nodes, so it can't promise not to throw
+static bool checkMoveUnequalAllocators()
+{
+    using Tagged = Dictionary<int, std::string, TaggedAllocator<std::pair<const int, std::string>>>;
+    static_assert(std::is_nothrow_move_assignable_v<Dictionary<int, std::string>>);
+    static_assert(!std::is_nothrow_move_assignable_v<Tagged>);
+
+    Tagged source(1, "one", TaggedAllocator<std::pair<const int, std::string>>(1));
+    source.insert(2, "two");
+    Tagged target(3, "three", TaggedAllocator<std::pair<const int, std::string>>(2));
+    target = std::move(source);
+
+    const bool passed{target.size() == 2ul && target.at(1) == "one" && target.at(2) == "two" &&
+                      !target.is_set(3) && target.get_allocator().tag == 2};
+    if (!passed)
+        std::cerr << "Failed: move assignment between unequal allocators lost elements" << std::endl;
+    return passed;
+}
+
+// Dictionary of 'count' keys from 1 to 'count' built by the bulk ctor on 'threads' threads
+static Dictionary<int, std::string> buildSorted(int count, size_t threads, std::map<int, std::string> &expected)
+{
+    std::vector<std::pair<int, std::string>> pairs;
+    for (int key{1}; key <= count; key++)
+    {
+        pairs.emplace_back(key, std::to_string(key));
+        expected[key] = std::to_string(key);
+    }
+    return threads == 1ul ? Dictionary<int, std::string>(pairs.begin(), pairs.end())
+                          : Dictionary<int, std::string>(pairs.begin(), pairs.end(), threads);
+}
+
+// Bulk ctor must reject keys that aren't strictly ascending
+static bool rejectsUnsorted(std::vector<std::pair<int, std::string>> const &pairs, size_t threads)
+{
+    try
+    {
+        Dictionary<int, std::string> dict(pairs.begin(), pairs.end(), threads);
+        return false;
+    }
+    catch (std::invalid_argument const &)
+    {
+        return true;
+    }
+}
+
+// Bulk ctor builds the same perfectly balanced tree as ascending insertion, heights included,
+// both on one thread and on several (100000 keys are above the parallel grain)
+static bool checkBulkCtor()
+{
+    bool passed{true};
+    for (size_t threads : {1ul, 4ul})
+    {
+        for (int count : {0, 1, 1023, 100'000})
+        {
+            std::map<int, std::string> expected;
+            const Dictionary<int, std::string> dict{buildSorted(count, threads, expected)};
+            passed = passed && sameContents(dict, expected, count) && (count == 0 || dict.get_key() == count / 2 + 1);
+        }
+
+        // Rotations after the bulk build rely on the heights it stored
+        std::map<int, std::string> expected;
+        Dictionary<int, std::string> dict{buildSorted(1023, threads, expected)};
+        for (int key{1023}; key > 511; key--)
+        {
+            dict.erase(key);
+            expected.erase(key);
+        }
+        passed = passed && dict.get_key() == 256 && sameContents(dict, expected, 1023);
+    }
+
+    const std::vector<std::pair<int, std::string>> unsorted{{1, "one"}, {3, "three"}, {2, "two"}};
+    const std::vector<std::pair<int, std::string>> duplicate{{1, "one"}, {2, "two"}, {2, "deux"}};
+    passed = passed && rejectsUnsorted(unsorted, 1ul) && rejectsUnsorted(unsorted, 4ul) &&
+             rejectsUnsorted(duplicate, 1ul) && rejectsUnsorted(duplicate, 4ul);
+
+    if (!passed)
+        std::cerr << "Failed: bulk ctor built a wrong tree or accepted unsorted keys" << std::endl;
+    return passed;
+}
+
+int main()
+{
+    if (!checkIsSet() || !checkRebalance() || !checkInsertErase() || !checkCopyMove() || !checkMoveUnequalAllocators())
+        return EXIT_FAILURE;
+
+    if (!checkBulkCtor())
+        return EXIT_FAILURE;
+
+    std::cout << "Passed" << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,234 @@
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include "include/hash_dictionary.hpp"
+#include "include/hash_dictionary_impl.hpp"
+
+// Compares every key in [-1, maxKey + 1] with "std::unordered_map": hits through "at()" and "get()", misses through both
+template <class Dict>
+static bool sameContents(Dict const &dict, std::unordered_map<int, std::string> const &expected, int maxKey)
+{
+    if (dict.size() != expected.size() || dict.empty() != expected.empty())
+        return false;
+    for (int key{-1}; key <= maxKey + 1; key++)
+    {
+        const auto it{expected.find(key)};
+        if (dict.is_set(key) != (it != expected.end()))
+            return false;
+        if (it != expected.end() && (dict.at(key) != it->second || dict.get(key) != it->second))
+            return false;
+        if (it == expected.end() && !dict.get(key).empty())
+            return false;
+    }
+    return true;
+}
+
+/// @brief Poor hash: every 'Group' consecutive keys share the same hash, so they form long probe sequences
+template <int Group>
+struct GroupHash
+{
+    size_t operator()(int key) const noexcept { return static_cast<size_t>(key / Group); }
+};
+
+// Random inserts, overwrites and erases against "std::unordered_map", table grows from empty several times
+template <class Hash>
+static bool matchesUnorderedMap(char const *name)
+{
+    constexpr int kMaxKey{3000};
+    std::mt19937 gen(11u);
+    std::uniform_int_distribution<int> keys(0, kMaxKey);
+
+    HashDictionary<int, std::string, Hash> dict;
+    std::unordered_map<int, std::string> expected;
+    size_t rehashes{};
+    for (int i{0}; i < 30'000; i++)
+    {
+        const int key{keys(gen)};
+        const size_t capacity{dict.capacity()};
+        if (gen() % 3u)
+        {
+            dict.insert(key, std::to_string(i));
+            expected[key] = std::to_string(i);
+        }
+        else
+        {
+            // Erased slot is filled by backward shift of the following elements
+            dict.erase(key);
+            expected.erase(key);
+        }
+        rehashes += dict.capacity() != capacity;
+
+        if (dict.load_factor() > dict.max_load_factor() || (i % 1000 == 0 && !sameContents(dict, expected, kMaxKey)))
+        {
+            std::cerr << "Failed: contents differ from std::unordered_map after " << i << " operations (" << name << ')'
+                      << std::endl;
+            return false;
+        }
+    }
+
+    if (rehashes < 3ul || !sameContents(dict, expected, kMaxKey))
+    {
+        std::cerr << "Failed: contents differ from std::unordered_map after rehashing (" << name << ')' << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Misses: "at()" and "set()" throw, "get()" gives the default value, "erase()" does nothing
+static bool checkMissingKey()
+{
+    HashDictionary<int, std::string> dict;
+    bool passed{!dict.is_set(1) && dict.get(1).empty()};
+    dict.erase(1);
+    dict.insert(1, "one");
+    dict.erase(2);
+
+    try
+    {
+        dict.at(2);
+        passed = false;
+    }
+    catch (std::out_of_range const &)
+    {
+    }
+    try
+    {
+        dict.set(2, "two");
+        passed = false;
+    }
+    catch (std::out_of_range const &)
+    {
+    }
+
+    dict.set(1, "uno");
+    passed = passed && dict.size() == 1ul && dict.at(1) == "uno" && !dict.is_set(2);
+    if (!passed)
+        std::cerr << "Failed: lookup of a missing key" << std::endl;
+    return passed;
+}
+
+// Too many keys with one hash: insertion is refused, and the elements that were already there stay
+static bool checkCollisionOverflow()
+{
+    struct SameHash
+    {
+        size_t operator()(int) const noexcept { return 42ul; }
+    };
+
+    HashDictionary<int, std::string, SameHash> dict;
+    std::unordered_map<int, std::string> expected;
+    int key{0};
+    try
+    {
+        for (; key < 1000; key++)
+        {
+            dict.insert(key, std::to_string(key));
+            expected[key] = std::to_string(key);
+        }
+        std::cerr << "Failed: insertion of 1000 keys with the same hash didn't throw" << std::endl;
+        return false;
+    }
+    catch (std::overflow_error const &)
+    {
+    }
+
+    // Table is still usable
+    dict.erase(0);
+    expected.erase(0);
+    dict.insert(key, "last");
+    expected[key] = "last";
+    if (!sameContents(dict, expected, key))
+    {
+        std::cerr << "Failed: refused insertion lost elements of the table" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/// @brief Global count of bytes allocated through each tag of "TaggedAllocator"
+inline long liveBytes[3]{};
+
+/// @brief Stateful allocator that propagates neither on copy nor on move assignment
+template <typename T>
+struct TaggedAllocator
+{
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::false_type;
+    using is_always_equal = std::false_type;
+
+    int tag{};
+
+    TaggedAllocator(int t = 0) noexcept : tag(t) {}
+    template <typename U>
+    TaggedAllocator(TaggedAllocator<U> const &other) noexcept : tag(other.tag) {}
+
+    T *allocate(size_t n)
+    {
+        liveBytes[tag] += static_cast<long>(n * sizeof(T));
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, size_t n) noexcept
+    {
+        liveBytes[tag] -= static_cast<long>(n * sizeof(T));
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template <typename U>
+    bool operator==(TaggedAllocator<U> const &other) const noexcept { return tag == other.tag; }
+};
+
+// Assignments keep the allocator of the target, and every table is freed by the allocator that allocated it
+static bool checkAllocatorPropagation()
+{
+    using Tagged = HashDictionary<int, std::string, std::hash<int>, std::equal_to<int>,
+                                  TaggedAllocator<std::pair<const int, std::string>>>;
+    static_assert(std::is_nothrow_move_assignable_v<HashDictionary<int, std::string>>);
+    static_assert(!std::is_nothrow_move_assignable_v<Tagged>);
+
+    bool passed{true};
+    {
+        std::unordered_map<int, std::string> expected;
+        Tagged source(TaggedAllocator<std::pair<const int, std::string>>(1));
+        for (int key{0}; key < 100; key++)
+        {
+            source.insert(key, std::to_string(key));
+            expected[key] = std::to_string(key);
+        }
+
+        Tagged copied(TaggedAllocator<std::pair<const int, std::string>>(2));
+        copied.insert(500, "old");
+        copied = source;
+        passed = sameContents(copied, expected, 100) && copied.get_allocator().tag == 2 && liveBytes[2] > 0l;
+
+        Tagged moved(TaggedAllocator<std::pair<const int, std::string>>(2));
+        moved = std::move(source);
+        passed = passed && sameContents(moved, expected, 100) && moved.get_allocator().tag == 2 && source.empty();
+        passed = passed && liveBytes[1] == 0l;
+    }
+
+    if (!passed || liveBytes[0] != 0l || liveBytes[1] != 0l || liveBytes[2] != 0l)
+    {
+        std::cerr << "Failed: assignment took the allocator of the source or freed memory with a wrong allocator"
+                  << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main()
+{
+    if (!matchesUnorderedMap<std::hash<int>>("std::hash") || !matchesUnorderedMap<GroupHash<16>>("clustered"))
+        return EXIT_FAILURE;
+
+    if (!checkMissingKey() || !checkCollisionOverflow() || !checkAllocatorPropagation())
+        return EXIT_FAILURE;
+
+    std::cout << "Passed" << std::endl;
+    return EXIT_SUCCESS;
+}
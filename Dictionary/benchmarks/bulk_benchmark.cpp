@@ -0,0 +1,77 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../include/dictionary.hpp"
+#include "../include/dictionary_impl.hpp"
+
+using Pairs = std::vector<std::pair<int, int>>;
+using Dict = Dictionary<int, int>;
+
+// Builds the dictionary by 'build' and prints seconds spent (copy and move ctors are explicit, so it's returned by pointer)
+template <typename Build>
+void run(std::string const &input, std::string const &method, Build const &build)
+{
+    const auto start{std::chrono::steady_clock::now()};
+    const std::unique_ptr<Dict> dict{build()};
+    const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+
+    std::cout << std::setw(8) << input << std::setw(30) << method << std::fixed << std::setprecision(3)
+              << std::setw(12) << elapsed.count() << "    (size " << dict->size() << ")\n";
+}
+
+// Usage: ./bulk_benchmark [count of keys, 10'000'000 by default] [count of threads, all cores by default]
+int main(int argc, char *argv[])
+{
+    const size_t count{argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10'000'000UL};
+    const size_t threads{argc > 2 ? std::strtoul(argv[2], nullptr, 10)
+                                  : std::max<size_t>(2ul, std::thread::hardware_concurrency())};
+
+    Pairs sorted(count);
+    for (size_t i{}; i < count; i++)
+        sorted[i] = {static_cast<int>(i), static_cast<int>(i)};
+    Pairs random(sorted);
+    std::shuffle(random.begin(), random.end(), std::mt19937(42));
+
+    const std::string parallel{"bulk, " + std::to_string(threads) + " threads"};
+    std::cout << count << " keys, " << std::thread::hardware_concurrency() << " cores\n"
+              << std::setw(8) << "input" << std::setw(30) << "method" << std::setw(12) << "build, s" << '\n';
+
+    auto insert{[](Pairs const &pairs)
+                {
+                    auto dict{std::make_unique<Dict>()};
+                    for (auto const &[key, value] : pairs)
+                        dict->insert(key, value);
+                    return dict;
+                }};
+
+    run("sorted", "insert()", [&sorted, &insert]
+        { return insert(sorted); });
+    run("sorted", "bulk", [&sorted]
+        { return std::make_unique<Dict>(sorted.begin(), sorted.end()); });
+    run("sorted", parallel, [&sorted, threads]
+        { return std::make_unique<Dict>(sorted.begin(), sorted.end(), threads); });
+
+    run("random", "insert()", [&random, &insert]
+        { return insert(random); });
+    // Unsorted input has to be sorted first, sorting is included in the time
+    run("random", "std::sort + bulk", [&random]
+        {
+            Pairs pairs(random);
+            std::sort(pairs.begin(), pairs.end());
+            return std::make_unique<Dict>(pairs.begin(), pairs.end()); });
+    run("random", "std::sort + " + parallel, [&random, threads]
+        {
+            Pairs pairs(random);
+            std::sort(pairs.begin(), pairs.end());
+            return std::make_unique<Dict>(pairs.begin(), pairs.end(), threads); });
+    return 0;
+}
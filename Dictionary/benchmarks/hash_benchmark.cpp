@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../include/dictionary.hpp"
+#include "../include/dictionary_impl.hpp"
+#include "../include/hash_dictionary.hpp"
+#include "../include/hash_dictionary_impl.hpp"
+
+// Same calls for all three containers
+template <typename Container>
+void put(Container &c, int key, int value) { c.insert(key, value); }
+void put(std::unordered_map<int, int> &c, int key, int value) { c.insert_or_assign(key, value); }
+
+template <typename Container>
+int find(Container const &c, int key) { return c.get(key); }
+int find(std::unordered_map<int, int> const &c, int key)
+{
+    const auto it{c.find(key)};
+    return it != c.end() ? it->second : 0;
+}
+
+// Returns nanoseconds per call of 'fn' for each key
+template <typename Fn>
+double measure(std::vector<int> const &keys, Fn const &fn)
+{
+    const auto start{std::chrono::steady_clock::now()};
+    for (int key : keys)
+        fn(key);
+    const std::chrono::duration<double, std::nano> elapsed{std::chrono::steady_clock::now() - start};
+    return elapsed.count() / static_cast<double>(keys.size());
+}
+
+/**
+ * @brief Runs all the workloads on the container
+ * @param keys keys to insert (even numbers)
+ * @param hits existing keys in random order
+ * @param misses missing keys (odd numbers)
+ * @param mixed keys for mixed workload: even - lookup, key % 4 == 1 - insert, key % 4 == 3 - erase
+ */
+template <typename Container>
+void run(std::string const &name, std::vector<int> const &keys, std::vector<int> const &hits,
+         std::vector<int> const &misses, std::vector<int> const &mixed)
+{
+    Container c;
+    long long checksum{};
+    const double insertNs{measure(keys, [&c](int key)
+                                  { put(c, key, key); })};
+    const double hitNs{measure(hits, [&c, &checksum](int key)
+                               { checksum += find(c, key); })};
+    const double missNs{measure(misses, [&c, &checksum](int key)
+                                { checksum += find(c, key); })};
+    const double mixedNs{measure(mixed, [&c, &checksum](int key)
+                                 {
+                                     if (key % 2 == 0)
+                                         checksum += find(c, key);
+                                     else if (key % 4 == 1)
+                                         put(c, key, key);
+                                     else
+                                         c.erase(key - 2); })};
+
+    std::cout << std::setw(20) << name << std::fixed << std::setprecision(1) << std::setw(12) << insertNs
+              << std::setw(12) << hitNs << std::setw(12) << missNs << std::setw(12) << mixedNs
+              << "    (checksum " << checksum << ")\n";
+}
+
+// Usage: ./hash_benchmark [count of keys, 1'000'000 by default]
+int main(int argc, char *argv[])
+{
+    const size_t count{argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1'000'000UL};
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 1 << 30);
+
+    std::vector<int> keys(count), misses(count), mixed(count);
+    for (size_t i{}; i < count; i++)
+    {
+        keys[i] = dist(gen) * 2;
+        misses[i] = dist(gen) * 2 + 1;
+        mixed[i] = (i % 2 == 0) ? keys[gen() % count] : misses[gen() % count];
+    }
+    std::vector<int> hits(keys);
+    std::shuffle(hits.begin(), hits.end(), gen);
+
+    std::cout << count << " keys, nanoseconds per operation\n"
+              << std::setw(20) << "container" << std::setw(12) << "insert" << std::setw(12) << "hit"
+              << std::setw(12) << "miss" << std::setw(12) << "mixed" << '\n';
+    run<HashDictionary<int, int>>("HashDictionary", keys, hits, misses, mixed);
+    run<std::unordered_map<int, int>>("std::unordered_map", keys, hits, misses, mixed);
+    run<Dictionary<int, int>>("Dictionary", keys, hits, misses, mixed);
+    return 0;
+}
@@ -0,0 +1,65 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../include/dictionary.hpp"
+#include "../include/dictionary_impl.hpp"
+
+// Returns nanoseconds per call of 'fn' for each key
+template <typename Fn>
+double measure(std::vector<int> const &keys, Fn const &fn)
+{
+    const auto start{std::chrono::steady_clock::now()};
+    for (int key : keys)
+        fn(key);
+    const std::chrono::duration<double, std::nano> elapsed{std::chrono::steady_clock::now() - start};
+    return elapsed.count() / static_cast<double>(keys.size());
+}
+
+void run(std::string const &name, std::vector<int> const &keys)
+{
+    // Lookups and erasures go in random order for all the insertion orders
+    std::vector<int> queries(keys);
+    std::shuffle(queries.begin(), queries.end(), std::mt19937(7));
+
+    Dictionary<int, int> dict;
+    long long checksum{};
+    const double insertNs{measure(keys, [&dict](int key)
+                                  { dict.insert(key, key); })};
+    const double lookupNs{measure(queries, [&dict, &checksum](int key)
+                                  { checksum += dict.get(key); })};
+    const double eraseNs{measure(queries, [&dict](int key)
+                                 { dict.erase(key); })};
+
+    std::cout << std::setw(10) << name << std::setw(12) << keys.size() << std::fixed << std::setprecision(1)
+              << std::setw(14) << insertNs << std::setw(14) << lookupNs << std::setw(14) << eraseNs
+              << "    (checksum " << checksum << ", left " << dict.size() << ")\n";
+}
+
+// Usage: ./insertion_benchmark [max count of keys, 1'000'000 by default]
+int main(int argc, char *argv[])
+{
+    const size_t maxKeys{argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1'000'000UL};
+
+    std::cout << std::setw(10) << "order" << std::setw(12) << "keys" << std::setw(14) << "insert ns"
+              << std::setw(14) << "get ns" << std::setw(14) << "erase ns" << '\n';
+    for (size_t count{1'000UL}; count <= maxKeys; count *= 10UL)
+    {
+        std::vector<int> keys(count);
+        std::iota(keys.begin(), keys.end(), 0);
+        run("sorted", keys);
+
+        std::reverse(keys.begin(), keys.end());
+        run("reversed", keys);
+
+        std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+        run("random", keys);
+    }
+    return 0;
+}
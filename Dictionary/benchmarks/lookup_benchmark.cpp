@@ -0,0 +1,54 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "../include/dictionary.hpp"
+#include "../include/dictionary_impl.hpp"
+
+// Looks up 'count' random existing keys.
+// Returns nanoseconds per lookup.
+double run(Dictionary<int, int> const &dict, std::vector<int> const &keys, size_t count, long long &checksum)
+{
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<size_t> index(0UL, keys.size() - 1UL);
+    std::vector<int> queries(count);
+    for (auto &query : queries)
+        query = keys[index(gen)];
+
+    const auto start{std::chrono::steady_clock::now()};
+    for (int query : queries)
+        checksum += dict.get(query);
+    const std::chrono::duration<double, std::nano> elapsed{std::chrono::steady_clock::now() - start};
+    return elapsed.count() / static_cast<double>(count);
+}
+
+// Usage: ./lookup_benchmark [max count of keys, 10'000'000 by default]
+int main(int argc, char *argv[])
+{
+    const size_t maxKeys{argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10'000'000UL};
+    constexpr size_t kLookups{1'000'000UL};
+
+    std::cout << std::setw(12) << "keys" << std::setw(16) << "ns/lookup" << '\n';
+    for (size_t keys{1'000UL}; keys <= maxKeys; keys *= 10UL)
+    {
+        // Keys are inserted in random order, so the tree isn't degenerate
+        std::vector<int> order(keys);
+        std::iota(order.begin(), order.end(), 0);
+        std::shuffle(order.begin(), order.end(), std::mt19937(42));
+
+        Dictionary<int, int> dict;
+        for (int key : order)
+            dict.insert(key, key);
+
+        long long checksum{};
+        const double ns{run(dict, order, kLookups, checksum)};
+        std::cout << std::setw(12) << keys << std::setw(16) << std::fixed << std::setprecision(1) << ns
+                  << "    (checksum " << checksum << ")\n";
+    }
+    return 0;
+}
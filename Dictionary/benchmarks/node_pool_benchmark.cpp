@@ -0,0 +1,142 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <malloc.h>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "../include/dictionary.hpp"
+#include "../include/dictionary_impl.hpp"
+#include "node_pool_allocator.hpp"
+#include "node_pool_allocator_impl.hpp"
+
+// Hardware cache-miss counter of this thread. If perf events aren't available
+// (no PMU in a VM, perf_event_paranoid) - 'read()' returns -1
+class CacheMisses
+{
+    int m_fd{-1};
+
+public:
+    CacheMisses()
+    {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        m_fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+    ~CacheMisses()
+    {
+        if (m_fd != -1)
+            close(m_fd);
+    }
+    CacheMisses(CacheMisses const &) = delete;
+    CacheMisses &operator=(CacheMisses const &) = delete;
+
+    void start()
+    {
+        if (m_fd != -1)
+        {
+            ioctl(m_fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(m_fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+    long long stop()
+    {
+        long long count{-1};
+        if (m_fd == -1)
+            return count;
+        ioctl(m_fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (::read(m_fd, &count, sizeof(count)) != sizeof(count))
+            count = -1;
+        return count;
+    }
+};
+
+struct Result
+{
+    double insertMops, lookupNs, bytesPerNode, insertMisses, lookupMisses;
+    long long checksum;
+};
+
+// Fills the dictionary with 'keys', then looks all of them up in another random order
+template <typename Dict>
+Result run(Dict &dict, std::vector<int> const &keys, std::vector<int> const &queries)
+{
+    CacheMisses misses;
+    Result result{};
+    const size_t heapBefore{mallinfo2().uordblks};
+
+    misses.start();
+    auto start{std::chrono::steady_clock::now()};
+    for (int key : keys)
+        dict.insert(key, key);
+    std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+    const long long insertMisses{misses.stop()};
+
+    result.insertMops = static_cast<double>(keys.size()) / elapsed.count() / 1e6;
+    result.bytesPerNode = static_cast<double>(mallinfo2().uordblks - heapBefore) / static_cast<double>(keys.size());
+
+    misses.start();
+    start = std::chrono::steady_clock::now();
+    for (int key : queries)
+        result.checksum += dict.get(key);
+    elapsed = std::chrono::steady_clock::now() - start;
+    const long long lookupMisses{misses.stop()};
+
+    result.lookupNs = elapsed.count() * 1e9 / static_cast<double>(queries.size());
+    result.insertMisses = insertMisses < 0 ? -1.0 : static_cast<double>(insertMisses) / static_cast<double>(keys.size());
+    result.lookupMisses = lookupMisses < 0 ? -1.0 : static_cast<double>(lookupMisses) / static_cast<double>(queries.size());
+    return result;
+}
+
+void print(std::string const &name, Result const &result)
+{
+    auto misses{[](double count)
+                { return count < 0 ? std::string("n/a") : std::to_string(count).substr(0, 5); }};
+    std::cout << std::setw(16) << name << std::fixed << std::setprecision(2) << std::setw(12) << result.insertMops
+              << std::setw(12) << result.bytesPerNode << std::setw(14) << misses(result.insertMisses)
+              << std::setw(12) << result.lookupNs << std::setw(14) << misses(result.lookupMisses)
+              << "    (checksum " << result.checksum << ")\n";
+}
+
+// Usage: ./node_pool_benchmark [count of keys, 1'000'000 by default]
+int main(int argc, char *argv[])
+{
+    const size_t count{argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1'000'000UL};
+
+    std::vector<int> keys(count);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+    std::vector<int> queries(keys);
+    std::shuffle(queries.begin(), queries.end(), std::mt19937(7));
+
+    std::cout << count << " random keys\n"
+              << std::setw(16) << "allocator" << std::setw(12) << "insert M/s" << std::setw(12) << "bytes/node"
+              << std::setw(14) << "misses/insert" << std::setw(12) << "get ns" << std::setw(14) << "misses/get" << '\n';
+    {
+        Dictionary<int, int> dict;
+        print("std::allocator", run(dict, keys, queries));
+    }
+    {
+        using Alloc = NodePoolAllocator<std::pair<const int, int>>;
+        NodePool pool;
+        Dictionary<int, int, Alloc> dict{Alloc(pool)};
+        print("NodePool", run(dict, keys, queries));
+    }
+    return 0;
+}
@@ -3,6 +3,7 @@
 
 #include <memory>
 #include <concepts>
+#include <iterator>
 
 template <class Key, class Value>
 class IDictionary
@@ -30,64 +31,103 @@ class Dictionary : public IDictionary<Key, Value>, public INotFoundException<Key
 
 private:
     struct Node;
-    std::shared_ptr<Node> m_root;
+    using NodeAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
 
-    /// @brief For multiple use 'certainNode(void)' method
-    static size_t counter;
+    // Nodes are owned by the dictionary and taken from 'm_alloc', so there is
+    // no reference counter and no separate control block for each of them
+    Node *m_root{};
 
-    /// @param node node from which to start count
-    /// @return Count of levels (nodes) of binary tree
-    constexpr size_t count(std::shared_ptr<Node> node) const;
+    /// @brief Count of elements, kept up to date by 'addNode()' and 'removeNodeByKey()'
+    size_t m_size{};
 
-    /// @brief Adding node to the binary tree
-    /// @tparam key which will be added to the node
-    /// @param node pointer to 'Node' struct
-    virtual constexpr void addNode(Key const &key, std::shared_ptr<Node> &node);
+    [[no_unique_address]] NodeAllocator m_alloc;
 
-    /// @brief Helper method that returns certain node by it's value
-    /// @param node pointer to 'Node' struct
-    /// @tparam key value of binary tree by which search will take place
-    /// @return Node if value exists in this binary tree
-    std::shared_ptr<Node> certainNode(std::shared_ptr<Node> &node, Key const &key) const;
+    /// @brief Allocates and constructs a node with the allocator of the dictionary
+    Node *createNode(Key const &key, Value const &value);
+
+    /// @brief Destroys a node and returns its memory to the allocator of the dictionary
+    void destroyNode(Node *node) noexcept;
+
+    /// @brief Destroys all nodes of the subtree (Non-recursive function)
+    void destroyTree(Node *node) noexcept;
+
+    /// @brief Helper method (Recursive function, depth is O(log n))
+    /// @param node node from which to start copying
+    /// @return Deep copy of the subtree
+    Node *copy(Node const *node);
+
+    /// @brief Subtrees smaller than this are built on the current thread
+    static constexpr size_t kParallelGrain{1ul << 15};
+
+    /// @brief Builds perfectly balanced subtree from sorted pairs, middle pair is the root
+    /// (Recursive function, depth is O(log n))
+    /// @param first iterator on the first of 'count' pairs sorted by key
+    /// @param count count of pairs
+    /// @return Root of the subtree
+    template <std::random_access_iterator It>
+    Node *buildTree(It first, size_t count);
+
+    /// @brief Builds perfectly balanced subtree from sorted pairs. Left subtrees of the top levels
+    /// are built on separate threads while the current thread builds right ones
+    /// @param first iterator on the first of 'count' pairs sorted by key
+    /// @param count count of pairs
+    /// @param threads count of threads that build the subtree
+    /// @return Root of the subtree
+    template <std::random_access_iterator It>
+    Node *buildTree(It first, size_t count, size_t threads);
+
+    /// @param node pointer to 'Node' struct (may be "nullptr")
+    /// @return Height of the subtree stored in the node, 0 for empty subtree
+    static constexpr int height(Node const *node) noexcept;
+
+    /// @brief Recalculates height of the node from heights of its children
+    static constexpr void updateHeight(Node *node) noexcept;
+
+    /// @brief Rotates subtree to the left, right child becomes the root of the subtree
+    static constexpr void rotateLeft(Node *&node) noexcept;
 
-    /// @brief Helper method that returns node number by it's value
+    /// @brief Rotates subtree to the right, left child becomes the root of the subtree
+    static constexpr void rotateRight(Node *&node) noexcept;
+
+    /// @brief Restores AVL property of the node (heights of children differ at most by 1)
+    /// with one or two rotations. Children of the node have to be balanced already
+    static constexpr void balance(Node *&node) noexcept;
+
+    /// @brief Adding node to the AVL tree (Recursive function, depth is O(log n))
+    /// @tparam key which will be added to the node
     /// @param node pointer to 'Node' struct
-    /// @tparam key value of binary tree by which search will take place
-    /// @return Number of node if value exists in this binary tree
-    constexpr size_t searchNodeNumberByKey(std::shared_ptr<Node> &node, Key const &key) const;
+    /// @return Node that stores 'key' (new one or already existing)
+    virtual constexpr Node *addNode(Key const &key, Node *&node);
+
+    /// @brief Helper method that returns certain node by it's key (Non-recursive function).
+    /// Descends from the root following the order of keys, so it takes O(log n) steps and
+    /// doesn't modify anything - can be called from several threads at once
+    /// @tparam key key of binary tree by which search will take place
+    /// @return Node if key exists in this binary tree, otherwise - "nullptr"
+    Node *certainNode(Key const &key) const noexcept;
 
     ///  @brief Helper method (Non-recursive function)
     ///  @param node pointer to 'Node' struct
     ///  @return Minimal node in binary tree (lower left element)
-    ///  starting from the specified number
-    std::shared_ptr<Node> minValue(std::shared_ptr<Node> &node) const;
+    ///  starting from the specified number, "nullptr" if tree is empty
+    static Node *minValue(Node *node) noexcept;
 
-    /// @brief Helper method (Recursive function)
+    /// @brief Helper method (Non-recursive function)
     /// @param node pointer to 'Node' struct
-    /// @return Max element in binary tree (lower right element)
-    std::shared_ptr<Node> maxValue(std::shared_ptr<Node> &node) const;
-
-    ///  @brief Helper method to find the previous node with specified node number
-    ///  @param node pointer to 'Node' struct
-    ///  @param nodeNumber node number as a pivot
-    ///  @return Previous node by node number
-    static std::shared_ptr<Node> previousNode(std::shared_ptr<Node> &node, size_t nodeNumber);
+    /// @return Max element in binary tree (lower right element), "nullptr" if tree is empty
+    static Node *maxValue(Node *node) noexcept;
 
-    ///  @brief Helper method to find the next node with specified node number
-    ///  @param node pointer to 'Node' struct
-    ///  @param nodeNumber node number as a pivot
-    ///  @return Next node by node number
-    static std::shared_ptr<Node> nextNode(std::shared_ptr<Node> &node, size_t nodeNumber);
-
-    ///  @brief Helper method that removes node from binary tree by value
+    ///  @brief Helper method that removes node from AVL tree by key and rebalances
+    ///  the tree on the way back (Recursive function, depth is O(log n))
     ///  @param node pointer to 'Node' struct
     ///  @tparam key value of the node which you want to erase from the binary tree
-    ///  @return Node which you want to delete
-    std::shared_ptr<Node> removeNodeByKey(std::shared_ptr<Node> node, Key const &key);
+    constexpr void removeNodeByKey(Node *&node, Key const &key);
 
     /// @brief Adding node to the tree binary tree
     /// @tparam key value which you want to add into the binary tree
-    virtual constexpr void addNode(Key const &key);
+    /// @return Node that stores 'key' (new one or already existing)
+    virtual constexpr Node *addNode(Key const &key);
 
     /// @brief Removes element in binary tree by value
     /// @tparam key value of the node which you want to remove
@@ -97,28 +137,55 @@ public:
     /// @brief Defaulted ctor
     explicit Dictionary() = default;
 
-    /// @brief Defaulted copy ctor
-    explicit Dictionary(Dictionary const &) = default;
+    /// @brief Ctor with allocator
+    /// @param alloc allocator for the nodes (it is rebound to the node type)
+    explicit Dictionary(Alloc const &alloc);
+
+    /// @brief Copy ctor, makes a deep copy of the tree
+    explicit Dictionary(Dictionary const &other);
 
-    /// @brief Defaulted move ctor
-    explicit Dictionary(Dictionary &&) = default;
+    /// @brief Move ctor, leaves 'other' empty
+    explicit Dictionary(Dictionary &&other) noexcept;
 
-    /// @brief Defaulted copy assignment operator
-    Dictionary &operator=(Dictionary const &) = default;
+    /// @brief Copy assignment operator, makes a deep copy of the tree
+    Dictionary &operator=(Dictionary const &other);
 
-    /// @brief Defaulted move assignment operator
-    Dictionary &operator=(Dictionary &&) noexcept = default;
+    /// @brief Move assignment operator, leaves 'other' empty. If the allocator doesn't propagate
+    /// and differs from the one of 'other', nodes are copied, so it can throw
+    Dictionary &operator=(Dictionary &&other) noexcept(NodeTraits::propagate_on_container_move_assignment::value ||
+                                                       NodeTraits::is_always_equal::value);
 
-    /// @brief Defaulted virtual dtor
-    virtual ~Dictionary() = default;
+    /// @brief Virtual dtor, destroys all the nodes
+    virtual ~Dictionary();
 
     /// @brief Ctor with params
     /// @tparam key key parameter
     /// @tparam value value to add into the dictionary
-    explicit Dictionary(Key const &key, Value const &value);
-
-    /// @return Count of elements in the dictionary
-    constexpr size_t size() const;
+    /// @param alloc allocator for the nodes
+    explicit Dictionary(Key const &key, Value const &value, Alloc const &alloc = Alloc());
+
+    /// @brief Ctor from a range of key-value pairs, builds perfectly balanced tree in O(n):
+    /// every node is allocated once, nothing is searched and nothing is rotated
+    /// @throw Exception "std::invalid_argument" if keys aren't strictly ascending
+    /// @param first, last range of pairs sorted by key without duplicate keys
+    /// @param alloc allocator for the nodes
+    template <std::random_access_iterator It>
+    explicit Dictionary(It first, It last, Alloc const &alloc = Alloc());
+
+    /// @brief Ctor from a range of key-value pairs, same as above, but subtrees are built on 'threads' threads.
+    /// Allocator has to be thread-safe ("std::allocator" is, "NodePoolAllocator" isn't)
+    /// @throw Exception "std::invalid_argument" if keys aren't strictly ascending
+    /// @param first, last range of pairs sorted by key without duplicate keys
+    /// @param threads count of threads, 1 - build on the current thread only
+    /// @param alloc allocator for the nodes
+    template <std::random_access_iterator It>
+    explicit Dictionary(It first, It last, size_t threads, Alloc const &alloc = Alloc());
+
+    /// @return Copy of the allocator of the dictionary
+    Alloc get_allocator() const noexcept { return Alloc(m_alloc); }
+
+    /// @return Count of elements in the dictionary (O(1))
+    constexpr size_t size() const noexcept;
 
     /// @brief Checks if container is empty
     /// @return "true" if empty, ohterwise - "false"
@@ -145,6 +212,7 @@ public:
     const Value &at(Key const &key) const;
 
     /// @brief Modifies value associated with 'key'
+    /// @throw Exception "std::out_of_range" if there is no key in the container
     /// @tparam key certain key that stores value
     /// @tparam value new value to set
     virtual constexpr void set(Key const &key, const Value &value) override;
@@ -154,7 +222,7 @@ public:
     /// @return "true" if 'key' is associated with some value, otherwise - "false"
     virtual constexpr bool is_set(Key const &key) const override;
 
-    /// @brief Inserting new element to the container
+    /// @brief Inserting new element to the container. If 'key' already exists, its value is replaced
     /// @tparam key key to which will be inserted value
     /// @tparam value value to insert
     constexpr void insert(Key const &key, Value const &value);
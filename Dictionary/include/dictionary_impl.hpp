@@ -1,13 +1,16 @@
 #ifndef DICTIONARY_IMPL_HPP
 #define DICTIONARY_IMPL_HPP
 
-#include "dictionary.hpp"
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <utility>
 
-template <typename Key, typename Value, typename Allocator>
-size_t Dictionary<Key, Value, Allocator>::counter = 0;
+#include "dictionary.hpp"
 
 /*
- * @brief Struct 'Node' describes node of the binary tree that has two branches
+ * @brief Struct 'Node' describes node of the AVL tree that has two branches
  * left branch value - value, that lower than node value, right branch value - greater than node value
  * @tparam T type of value of the node
  */
@@ -17,248 +20,426 @@ struct Dictionary<Key, Value, Allocator>::Node
     std::pair<Key, Value> m_data;
 
     // Points on left root of tree
-    std::shared_ptr<Node> m_leftRoot;
+    Node *m_leftRoot{};
 
     // Points on right root of tree
-    std::shared_ptr<Node> m_rightRoot;
+    Node *m_rightRoot{};
 
-    explicit Node() : m_leftRoot(nullptr), m_rightRoot(nullptr) { m_data.second = Value{}; }
+    // Height of the subtree, leaf has height 1
+    int m_height{1};
 
-    explicit Node(Key const &key) : m_leftRoot(nullptr), m_rightRoot(nullptr)
-    {
-        m_data.first = std::move(key);
-        m_data.second = Value{};
-    }
+    explicit Node(Key const &key, Value const &value) : m_data(key, value) {}
+};
 
-    explicit Node(Key const &key, Value const &value) : m_leftRoot(nullptr), m_rightRoot(nullptr)
+template <typename Key, typename Value, typename Allocator>
+typename Dictionary<Key, Value, Allocator>::Node *
+Dictionary<Key, Value, Allocator>::createNode(Key const &key, Value const &value)
+{
+    Node *node{NodeTraits::allocate(m_alloc, 1)};
+    try
     {
-        m_data.first = std::move(key);
-        m_data.second = std::move(value);
+        NodeTraits::construct(m_alloc, node, key, value);
     }
-
-    explicit Node(std::pair<Key const, Value> const &x) : m_data(std::move(x)) {}
-
-    explicit Node(Node const &) = default;
-    explicit Node(Node &&) = default;
-
-    // Returns max depth from two roots
-    constexpr size_t max() const noexcept
+    catch (...)
     {
-        const size_t left_depth{m_leftRoot ? m_leftRoot->max() : 0};
-        const size_t right_depth{m_rightRoot ? m_rightRoot->max() : 0};
-        return (left_depth > right_depth ? left_depth : right_depth) + 1;
+        NodeTraits::deallocate(m_alloc, node, 1);
+        throw;
     }
-
-    virtual ~Node() = default;
-};
+    return node;
+}
 
 template <typename Key, typename Value, typename Allocator>
-constexpr size_t
-Dictionary<Key, Value, Allocator>::count(std::shared_ptr<Dictionary<Key, Value, Allocator>::Node> node) const
+void Dictionary<Key, Value, Allocator>::destroyNode(Node *node) noexcept
 {
-    return (node == nullptr) ? 0 : (1 + count(node->m_leftRoot) + count(node->m_rightRoot));
+    NodeTraits::destroy(m_alloc, node);
+    NodeTraits::deallocate(m_alloc, node, 1);
 }
 
 template <typename Key, typename Value, typename Allocator>
-constexpr void
-Dictionary<Key, Value, Allocator>::addNode(Key const &key, std::shared_ptr<Node> &node)
+void Dictionary<Key, Value, Allocator>::destroyTree(Node *node) noexcept
 {
-    if (node == nullptr)
-        node = std::make_shared<Node>(key);
-    else
+    while (node != nullptr)
     {
-        if (key < node->m_data.first)
+        // Rotating left children up turns the tree into a right-leaning list,
+        // so there is neither recursion nor stack
+        if (node->m_leftRoot != nullptr)
         {
-            if (node->m_leftRoot != nullptr)
-                addNode(key, node->m_leftRoot);
-            else
-                node->m_leftRoot = std::make_shared<Node>(key);
+            Node *left{node->m_leftRoot};
+            node->m_leftRoot = left->m_rightRoot;
+            left->m_rightRoot = node;
+            node = left;
         }
-        else if (key >= node->m_data.first)
+        else
         {
-            if (node->m_rightRoot != nullptr)
-                addNode(key, node->m_rightRoot);
-            else
-                node->m_rightRoot = std::make_shared<Node>(key);
+            Node *right{node->m_rightRoot};
+            destroyNode(node);
+            node = right;
         }
     }
 }
 
 template <typename Key, typename Value, typename Allocator>
-std::shared_ptr<struct Dictionary<Key, Value, Allocator>::Node>
-Dictionary<Key, Value, Allocator>::certainNode(std::shared_ptr<Node> &node, Key const &key) const
+typename Dictionary<Key, Value, Allocator>::Node *
+Dictionary<Key, Value, Allocator>::copy(Node const *node)
 {
-    static std::shared_ptr<Node> pnode;
-
     if (node == nullptr)
         return nullptr;
-    else
+
+    Node *pnode{createNode(node->m_data.first, node->m_data.second)};
+    try
+    {
+        pnode->m_leftRoot = copy(node->m_leftRoot);
+        pnode->m_rightRoot = copy(node->m_rightRoot);
+    }
+    catch (...)
     {
-        if (key == node->m_data.first)
-            pnode = node;
+        destroyTree(pnode);
+        throw;
+    }
+    pnode->m_height = node->m_height;
+    return pnode;
+}
 
-        certainNode(node->m_leftRoot, key);
-        certainNode(node->m_rightRoot, key);
+template <typename Key, typename Value, typename Allocator>
+template <std::random_access_iterator It>
+typename Dictionary<Key, Value, Allocator>::Node *
+Dictionary<Key, Value, Allocator>::buildTree(It first, size_t count)
+{
+    if (count == 0)
+        return nullptr;
 
-        return pnode;
+    const size_t half{count / 2};
+    Node *pnode{createNode(first[half].first, first[half].second)};
+    try
+    {
+        pnode->m_leftRoot = buildTree(first, half);
+        pnode->m_rightRoot = buildTree(first + half + 1, count - half - 1);
+    }
+    catch (...)
+    {
+        destroyTree(pnode);
+        throw;
     }
+    // Sizes of the subtrees differ at most by 1, so do their heights
+    updateHeight(pnode);
+    return pnode;
 }
 
 template <typename Key, typename Value, typename Allocator>
-constexpr size_t
-Dictionary<Key, Value, Allocator>::searchNodeNumberByKey(std::shared_ptr<Node> &node, Key const &key) const
+template <std::random_access_iterator It>
+typename Dictionary<Key, Value, Allocator>::Node *
+Dictionary<Key, Value, Allocator>::buildTree(It first, size_t count, size_t threads)
 {
-    static size_t nodeNumber{};
+    if (threads < 2 || count < kParallelGrain)
+        return buildTree(first, count);
 
-    if (node == nullptr)
-        return 0;
-    else
-    {
-        counter++;
-        if (key == node->m_data.first)
-            nodeNumber = counter;
+    const size_t half{count / 2};
+    Node *pnode{createNode(first[half].first, first[half].second)};
 
-        searchNodeNumberByKey(node->m_leftRoot, key);
-        searchNodeNumberByKey(node->m_rightRoot, key);
+    Node *left{};
+    std::exception_ptr leftError;
+    try
+    {
+        std::jthread leftBuilder([this, &left, &leftError, first, half, threads]
+                                 {
+                                     try
+                                     {
+                                         left = buildTree(first, half, threads / 2);
+                                     }
+                                     catch (...)
+                                     {
+                                         leftError = std::current_exception();
+                                     } });
+        pnode->m_rightRoot = buildTree(first + half + 1, count - half - 1, threads - threads / 2);
+    }
+    catch (...)
+    {
+        // 'leftBuilder' is joined already
+        destroyTree(left);
+        destroyTree(pnode);
+        throw;
+    }
 
-        return nodeNumber;
+    pnode->m_leftRoot = left;
+    if (leftError)
+    {
+        destroyTree(pnode);
+        std::rethrow_exception(leftError);
     }
+    updateHeight(pnode);
+    return pnode;
 }
 
 template <typename Key, typename Value, typename Allocator>
-std::shared_ptr<struct Dictionary<Key, Value, Allocator>::Node>
-Dictionary<Key, Value, Allocator>::minValue(std::shared_ptr<Node> &node) const
+constexpr int
+Dictionary<Key, Value, Allocator>::height(Node const *node) noexcept
 {
-    std::shared_ptr<Node> pnode{node};
-    while (pnode->m_leftRoot != nullptr)
-        pnode = pnode->m_leftRoot;
-    return pnode;
+    return node ? node->m_height : 0;
 }
 
 template <typename Key, typename Value, typename Allocator>
-std::shared_ptr<struct Dictionary<Key, Value, Allocator>::Node>
-Dictionary<Key, Value, Allocator>::maxValue(std::shared_ptr<Node> &node) const
+constexpr void
+Dictionary<Key, Value, Allocator>::updateHeight(Node *node) noexcept
 {
-    // Tree is empty
-    if (node == nullptr)
-        return nullptr;
-    // Tree is not empty
-    else
-        return (node->m_rightRoot == nullptr) ? node : maxValue(node->m_rightRoot);
+    const int left_height{height(node->m_leftRoot)}, right_height{height(node->m_rightRoot)};
+    node->m_height = (left_height > right_height ? left_height : right_height) + 1;
 }
 
 template <typename Key, typename Value, typename Allocator>
-std::shared_ptr<struct Dictionary<Key, Value, Allocator>::Node>
-Dictionary<Key, Value, Allocator>::previousNode(std::shared_ptr<Node> &node, size_t nodeNumber)
+constexpr void
+Dictionary<Key, Value, Allocator>::rotateLeft(Node *&node) noexcept
 {
-    static std::shared_ptr<Node> pprev;
+    // node(A, pivot(B, C)) -> pivot(node(A, B), C)
+    Node *pivot{node->m_rightRoot};
+    node->m_rightRoot = pivot->m_leftRoot;
+    updateHeight(node);
+    pivot->m_leftRoot = node;
+    updateHeight(pivot);
+    node = pivot;
+}
+
+template <typename Key, typename Value, typename Allocator>
+constexpr void
+Dictionary<Key, Value, Allocator>::rotateRight(Node *&node) noexcept
+{
+    // node(pivot(A, B), C) -> pivot(A, node(B, C))
+    Node *pivot{node->m_leftRoot};
+    node->m_leftRoot = pivot->m_rightRoot;
+    updateHeight(node);
+    pivot->m_rightRoot = node;
+    updateHeight(pivot);
+    node = pivot;
+}
+
+template <typename Key, typename Value, typename Allocator>
+constexpr void
+Dictionary<Key, Value, Allocator>::balance(Node *&node) noexcept
+{
+    updateHeight(node);
+    const int factor{height(node->m_rightRoot) - height(node->m_leftRoot)};
+
+    // Right subtree is too high
+    if (factor > 1)
+    {
+        // Right-left case: first make right child right-heavy
+        if (height(node->m_rightRoot->m_leftRoot) > height(node->m_rightRoot->m_rightRoot))
+            rotateRight(node->m_rightRoot);
+        rotateLeft(node);
+    }
+    // Left subtree is too high
+    else if (factor < -1)
+    {
+        // Left-right case: first make left child left-heavy
+        if (height(node->m_leftRoot->m_rightRoot) > height(node->m_leftRoot->m_leftRoot))
+            rotateLeft(node->m_leftRoot);
+        rotateRight(node);
+    }
+}
 
+template <typename Key, typename Value, typename Allocator>
+constexpr typename Dictionary<Key, Value, Allocator>::Node *
+Dictionary<Key, Value, Allocator>::addNode(Key const &key, Node *&node)
+{
     if (node == nullptr)
-        return nullptr;
-    else
     {
-        counter++;
+        node = createNode(key, Value{});
+        m_size++;
+        return node;
+    }
 
-        if (counter == (nodeNumber - 1))
-            pprev = node;
+    Node *pnode{};
+    if (key < node->m_data.first)
+        pnode = addNode(key, node->m_leftRoot);
+    else if (node->m_data.first < key)
+        pnode = addNode(key, node->m_rightRoot);
+    // Key already exists - nothing to rebalance
+    else
+        return node;
 
-        previousNode(node->m_leftRoot, nodeNumber);
-        previousNode(node->m_rightRoot, nodeNumber);
+    // Rotations only relink nodes, so 'pnode' stays valid
+    balance(node);
+    return pnode;
+}
 
-        return pprev;
+template <typename Key, typename Value, typename Allocator>
+typename Dictionary<Key, Value, Allocator>::Node *
+Dictionary<Key, Value, Allocator>::certainNode(Key const &key) const noexcept
+{
+    Node *pnode{m_root};
+    while (pnode != nullptr)
+    {
+        if (key < pnode->m_data.first)
+            pnode = pnode->m_leftRoot;
+        else if (pnode->m_data.first < key)
+            pnode = pnode->m_rightRoot;
+        else
+            return pnode;
     }
+    return nullptr;
 }
 
 template <typename Key, typename Value, typename Allocator>
-std::shared_ptr<struct Dictionary<Key, Value, Allocator>::Node>
-Dictionary<Key, Value, Allocator>::nextNode(std::shared_ptr<Node> &node, size_t nodeNumber)
+typename Dictionary<Key, Value, Allocator>::Node *
+Dictionary<Key, Value, Allocator>::minValue(Node *node) noexcept
 {
-    static std::shared_ptr<Node> pnext;
-
     if (node == nullptr)
         return nullptr;
-    else
-    {
-        counter++;
 
-        if (counter == (nodeNumber + 1))
-            pnext = node;
+    while (node->m_leftRoot != nullptr)
+        node = node->m_leftRoot;
+    return node;
+}
 
-        nextNode(node->m_leftRoot, nodeNumber);
-        nextNode(node->m_rightRoot, nodeNumber);
+template <typename Key, typename Value, typename Allocator>
+typename Dictionary<Key, Value, Allocator>::Node *
+Dictionary<Key, Value, Allocator>::maxValue(Node *node) noexcept
+{
+    if (node == nullptr)
+        return nullptr;
 
-        return pnext;
-    }
+    while (node->m_rightRoot != nullptr)
+        node = node->m_rightRoot;
+    return node;
 }
 
 template <typename Key, typename Value, typename Allocator>
-std::shared_ptr<struct Dictionary<Key, Value, Allocator>::Node>
-Dictionary<Key, Value, Allocator>::removeNodeByKey(std::shared_ptr<Node> node, Key const &key)
+constexpr void
+Dictionary<Key, Value, Allocator>::removeNodeByKey(Node *&node, Key const &key)
 {
-    // If tree is emplty -> return null
+    // There is no such key
     if (node == nullptr)
-        return nullptr;
+        return;
+
+    // If node value which we want to delete is smaller than the root's value, then it lies in left subtree
+    if (key < node->m_data.first)
+        removeNodeByKey(node->m_leftRoot, key);
+    // If node value which we want to delete is greater than the root's value, then it lies in right subtree
+    else if (node->m_data.first < key)
+        removeNodeByKey(node->m_rightRoot, key);
+    // If node value equals specified value -> found node which we want to delete
     else
     {
-        // If node value which we want to delete is smaller than the root's value, then it lies in left subtree
-        if (key < node->m_data.first)
-            node->m_leftRoot = removeNodeByKey(node->m_leftRoot, key);
-        // If node value which we want to delete is greater than the root's value, then it lies in left subtree
-        else if (key > node->m_data.first)
-            node->m_rightRoot = removeNodeByKey(node->m_rightRoot, key);
-        // If node value equals specified value -> found node which we want to delete
-        else
+        // Case 1 and 2: Node has no child or has only 1 child
+        if (node->m_leftRoot == nullptr || node->m_rightRoot == nullptr)
         {
-            // Case 1: Node has no child or has only 1 (left) child
-            if (node->m_rightRoot == nullptr)
-                return node->m_leftRoot;
-            // Case 2: Node has no child or has only 1 (right) child
-            else if (node->m_leftRoot == nullptr)
-                return node->m_rightRoot;
-            else
-            {
-                // Case 3: Node has 2 children
-                // Smallest in the right subtree
-                std::shared_ptr<Node> ptmp{minValue(node->m_rightRoot)};
-                // Copy the inorder successor's data to this node
-                node->m_data.first = ptmp->m_data.first;
-                // Delete the inorder successor
-                node->m_rightRoot = removeNodeByKey(node->m_rightRoot, ptmp->m_data.first);
-            }
+            Node *child{node->m_leftRoot ? node->m_leftRoot : node->m_rightRoot};
+            destroyNode(node);
+            node = child;
+            m_size--;
+            return;
         }
+        // Case 3: Node has 2 children
+        // Smallest in the right subtree
+        Node const *ptmp{minValue(node->m_rightRoot)};
+        // Copy the inorder successor's data to this node
+        node->m_data = ptmp->m_data;
+        // Delete the inorder successor
+        removeNodeByKey(node->m_rightRoot, node->m_data.first);
     }
-    return node;
+    balance(node);
 }
 
 template <typename Key, typename Value, typename Allocator>
-constexpr void
+constexpr typename Dictionary<Key, Value, Allocator>::Node *
 Dictionary<Key, Value, Allocator>::addNode(Key const &key)
 {
-    addNode(key, m_root);
+    return addNode(key, m_root);
 }
 
 template <typename Key, typename Value, typename Allocator>
 constexpr void
 Dictionary<Key, Value, Allocator>::removeNode(Key const &key)
 {
-    if (counter != 0)
-        counter = 0;
+    removeNodeByKey(m_root, key);
+}
 
-    if (m_root == nullptr)
-        return;
-    else
-        m_root = removeNodeByKey(m_root, key);
+template <typename Key, typename Value, typename Allocator>
+Dictionary<Key, Value, Allocator>::Dictionary(Allocator const &alloc) : m_alloc(alloc) {}
+
+template <typename Key, typename Value, typename Allocator>
+Dictionary<Key, Value, Allocator>::Dictionary(Key const &key, Value const &value, Allocator const &alloc)
+    : m_alloc(alloc)
+{
+    m_root = createNode(key, value);
+    m_size = 1;
 }
 
 template <typename Key, typename Value, typename Allocator>
-Dictionary<Key, Value, Allocator>::Dictionary(Key const &key, Value const &value)
+template <std::random_access_iterator It>
+Dictionary<Key, Value, Allocator>::Dictionary(It first, It last, Allocator const &alloc)
+    : Dictionary(first, last, 1, alloc) {}
+
+template <typename Key, typename Value, typename Allocator>
+template <std::random_access_iterator It>
+Dictionary<Key, Value, Allocator>::Dictionary(It first, It last, size_t threads, Allocator const &alloc)
+    : m_alloc(alloc)
 {
-    m_root = std::make_shared<Node>(key, value);
+    if (std::adjacent_find(first, last, [](auto const &lhs, auto const &rhs)
+                           { return !(lhs.first < rhs.first); }) != last)
+        throw std::invalid_argument("Exception: std::invalid_argument: keys have to be sorted in ascending order without duplicates");
+
+    const size_t count{static_cast<size_t>(last - first)};
+    m_root = buildTree(first, count, threads);
+    m_size = count;
+}
+
+template <typename Key, typename Value, typename Allocator>
+Dictionary<Key, Value, Allocator>::Dictionary(Dictionary const &other)
+    : m_alloc(NodeTraits::select_on_container_copy_construction(other.m_alloc))
+{
+    m_root = copy(other.m_root);
+    m_size = other.m_size;
+}
+
+template <typename Key, typename Value, typename Allocator>
+Dictionary<Key, Value, Allocator>::Dictionary(Dictionary &&other) noexcept
+    : m_root(std::exchange(other.m_root, nullptr)), m_size(std::exchange(other.m_size, 0)),
+      m_alloc(std::move(other.m_alloc)) {}
+
+template <typename Key, typename Value, typename Allocator>
+Dictionary<Key, Value, Allocator>::~Dictionary() { clear(); }
+
+template <typename Key, typename Value, typename Allocator>
+Dictionary<Key, Value, Allocator> &
+Dictionary<Key, Value, Allocator>::operator=(Dictionary const &other)
+{
+    if (this != &other)
+    {
+        clear();
+        if constexpr (NodeTraits::propagate_on_container_copy_assignment::value)
+            m_alloc = other.m_alloc;
+        m_root = copy(other.m_root);
+        m_size = other.m_size;
+    }
+    return *this;
+}
+
+template <typename Key, typename Value, typename Allocator>
+Dictionary<Key, Value, Allocator> &
+Dictionary<Key, Value, Allocator>::operator=(Dictionary &&other) noexcept(NodeTraits::propagate_on_container_move_assignment::value ||
+                                                                           NodeTraits::is_always_equal::value)
+{
+    if (this != &other)
+    {
+        clear();
+        if constexpr (NodeTraits::propagate_on_container_move_assignment::value)
+            m_alloc = std::move(other.m_alloc);
+        // Nodes from another pool can't be adopted - copying them
+        else if (!NodeTraits::is_always_equal::value && m_alloc != other.m_alloc)
+        {
+            m_root = copy(other.m_root);
+            m_size = other.m_size;
+            return *this;
+        }
+        m_root = std::exchange(other.m_root, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+    }
+    return *this;
 }
 
 template <typename Key, typename Value, typename Allocator>
 constexpr size_t
-Dictionary<Key, Value, Allocator>::size() const { return count(m_root); }
+Dictionary<Key, Value, Allocator>::size() const noexcept { return m_size; }
 
 template <typename Key, typename Value, typename Allocator>
 constexpr bool
@@ -267,6 +448,8 @@ Dictionary<Key, Value, Allocator>::empty() const { return size() == 0; }
 template <typename Key, typename Value, typename Allocator>
 void Dictionary<Key, Value, Allocator>::clear() noexcept
 {
+    destroyTree(std::exchange(m_root, nullptr));
+    m_size = 0;
 }
 
 template <typename Key, typename Value, typename Allocator>
@@ -285,30 +468,22 @@ template <typename Key, typename Value, typename Allocator>
 const Value &
 Dictionary<Key, Value, Allocator>::get(Key const &key) const
 {
-    // Move 'm_root' content to a new variable
-    std::shared_ptr<Node> pnode{std::move(m_root)};
-    pnode = certainNode(pnode, key);
+    // Returned if there is no such key. It is never modified, so sharing it between threads is safe
+    static const Value null{};
 
-    // Initialize empty value to return it if method 'certainNode()' returns "nullptr"
-    // as result of searching node with specified key
-    Value null{Value()};
-
-    // Searching necessary value by key with the helper method
-    return pnode->m_data.first == key ? pnode->m_data.second : null;
+    Node const *pnode{certainNode(key)};
+    return pnode ? pnode->m_data.second : null;
 }
 
 template <typename Key, typename Value, typename Allocator>
 const Value &
 Dictionary<Key, Value, Allocator>::at(Key const &key) const
 {
-    std::shared_ptr<Node> pnode{std::move(m_root)};
-    pnode = certainNode(pnode, key);
+    Node const *pnode{certainNode(key)};
 
     // If helper method 'certainNode()' returns "nullptr" -> throw an exception
     if (!pnode)
         throw std::out_of_range("Exception: std::out_of_range: Container does not contains specified key");
-
-    // Searching necessary value by key with the helper method
     return pnode->m_data.second;
 }
 
@@ -316,30 +491,26 @@ template <typename Key, typename Value, typename Allocator>
 constexpr void
 Dictionary<Key, Value, Allocator>::set(Key const &key, const Value &value)
 {
-    // Making a copy of the root
-    std::shared_ptr<Node> pnode{m_root}, ptmp{certainNode(pnode, key)};
+    Node *pnode{certainNode(key)};
+    if (!pnode)
+        throw std::out_of_range("Exception: std::out_of_range: Container does not contains specified key");
     // Replaces old value associated with specified key with a new value
-    ptmp->m_data.second = value;
+    pnode->m_data.second = value;
 }
 
 template <typename Key, typename Value, typename Allocator>
 constexpr bool
 Dictionary<Key, Value, Allocator>::is_set(Key const &key) const
 {
-    std::shared_ptr<Node> pnode{std::move(m_root)};
-    pnode = certainNode(pnode, key);
-    // If 'pnode' stores "nullptr" (if there is no such node with specified key)
-    // - returns false, otherwise - true
-    return !pnode;
+    return certainNode(key) != nullptr;
 }
 
 template <typename Key, typename Value, typename Allocator>
 constexpr void
 Dictionary<Key, Value, Allocator>::insert(Key const &key, Value const &value)
 {
-    addNode(key);
-    std::shared_ptr<Node> pnode{m_root}, ptmp{certainNode(m_root, key)};
-    ptmp->m_data.second = value;
+    // Keys are unique: existing key only gets a new value
+    addNode(key)->m_data.second = value;
 }
 
 template <typename Key, typename Value, typename Allocator>
@@ -353,8 +524,7 @@ template <typename Key, typename Value, typename Allocator>
 constexpr Value &
 Dictionary<Key, Value, Allocator>::min() const
 {
-    std::shared_ptr<Node> pnode{std::move(m_root)};
-    pnode = minValue(pnode);
+    Node *pnode{minValue(m_root)};
     if (!pnode)
         throw std::out_of_range("Exception: std::out_of_range: Container is empty!");
     return pnode->m_data.second;
@@ -364,8 +534,7 @@ template <typename Key, typename Value, typename Allocator>
 constexpr Value &
 Dictionary<Key, Value, Allocator>::max() const
 {
-    std::shared_ptr<Node> pnode{std::move(m_root)};
-    pnode = maxValue(pnode);
+    Node *pnode{maxValue(m_root)};
     if (!pnode)
         throw std::out_of_range("Exception: std::out_of_range: Container is empty!");
     return pnode->m_data.second;
@@ -0,0 +1,183 @@
+#ifndef HASH_DICTIONARY_HPP
+#define HASH_DICTIONARY_HPP
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "dictionary.hpp"
+
+/*
+ * @brief Unordered dictionary - hash table with open addressing and Robin Hood probing.
+ * All elements live in one flat array of slots, next to it there is an array of one-byte
+ * probe distances (0 - slot is empty, d - element is 'd - 1' slots away from its home slot).
+ * While inserting, element that is farther from its home slot takes the slot of element that
+ * is closer to its own one, so all probe sequences are short and lookup of missing key stops
+ * as soon as it meets element closer to home than itself. Removal shifts following elements
+ * one slot back, so there are no tombstones.
+ * @tparam Key type of keys
+ * @tparam Value type of values
+ * @tparam Hash hash function for keys
+ * @tparam KeyEqual comparison function for keys
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+          typename Alloc = std::allocator<std::pair<const Key, Value>>>
+class HashDictionary : public IDictionary<Key, Value>
+{
+    static_assert(std::is_copy_assignable_v<Value>, "Type of value have to be copyable, assignable and comparable.");
+
+private:
+    using Slot = std::pair<Key, Value>;
+    using SlotAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Slot>;
+    using SlotTraits = std::allocator_traits<SlotAllocator>;
+    using DistanceAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<uint8_t>;
+    using DistanceTraits = std::allocator_traits<DistanceAllocator>;
+
+    /// @brief Max probe distance that fits into one byte. Reaching it forces table to grow
+    static constexpr uint8_t kMaxDistance{255u};
+
+    /// @brief Count of slots of the first allocated table
+    static constexpr size_t kMinCapacity{16ul};
+
+    Slot *m_slots{};          // Flat array of elements, constructed only where 'm_distances[i] != 0'
+    uint8_t *m_distances{};   // Probe distance for each slot, 0 - empty slot
+    size_t m_capacity{};      // Count of slots (power of two or 0)
+    size_t m_size{};          // Count of elements
+    int m_shift{64};          // Hash is multiplied and shifted right by this to get home slot
+    float m_maxLoadFactor{};  // Table grows when 'm_size' exceeds 'm_capacity * m_maxLoadFactor'
+    [[no_unique_address]] Hash m_hash;
+    [[no_unique_address]] KeyEqual m_equal;
+    [[no_unique_address]] SlotAllocator m_slotAlloc;
+    [[no_unique_address]] DistanceAllocator m_distanceAlloc;
+
+    /// @return Home slot of the key in the table with the specified shift. Fibonacci hashing spreads
+    /// even poor hashes (like identity 'std::hash<int>') over the whole table
+    size_t homeSlot(Key const &key, int shift) const noexcept;
+
+    /// @return Index of slot that stores 'key', 'm_capacity' if there is no such key
+    size_t findSlot(Key const &key) const noexcept;
+
+    /// @brief Follows Robin Hood insertion from slot 'i' on probe distances only - they alone decide
+    /// which element gives its slot away, so it tells whether an element fits without moving any
+    /// @param place if "true", 'distances' are updated as if the element were inserted
+    /// @return "false" if some probe distance would exceed 'kMaxDistance'
+    static bool probe(uint8_t *distances, size_t mask, size_t i, bool place) noexcept;
+
+    /// @brief Puts new element into the table without checking for duplicates and load factor.
+    /// It has to fit, see "probe()"
+    void placeNew(Slot &&slot);
+
+    /// @brief Reallocates table with specified count of slots (or more, if some probe distance
+    /// would exceed 'kMaxDistance' there) and reinserts all the elements
+    /// @throw Exception "std::overflow_error" if table is sparse and still has such long probe sequence,
+    /// then the table isn't changed
+    void rehash(size_t capacity);
+
+    /// @brief Copy ctor that allocates the table with specified allocators
+    HashDictionary(HashDictionary const &other, SlotAllocator const &slotAlloc, DistanceAllocator const &distanceAlloc);
+
+    /// @brief Takes the table, hash and comparison functions of 'other', but not its allocators.
+    /// Current table has to be released
+    void adopt(HashDictionary &other) noexcept;
+
+    /// @brief Destroys all elements and frees memory
+    void release() noexcept;
+
+public:
+    /// @brief Default max load factor
+    static constexpr float kDefaultMaxLoadFactor{0.875f};
+
+    /// @brief Ctor with params
+    /// @param maxLoadFactor max ratio of count of elements to count of slots, has to be in (0, 1]
+    /// @throw Exception "std::invalid_argument" if 'maxLoadFactor' is out of range
+    explicit HashDictionary(float maxLoadFactor = kDefaultMaxLoadFactor);
+
+    /// @brief Ctor with allocator
+    /// @param alloc allocator for the table (it is rebound to the slot and distance types)
+    /// @param maxLoadFactor max ratio of count of elements to count of slots, has to be in (0, 1]
+    /// @throw Exception "std::invalid_argument" if 'maxLoadFactor' is out of range
+    explicit HashDictionary(Alloc const &alloc, float maxLoadFactor = kDefaultMaxLoadFactor);
+
+    /// @brief Copy ctor
+    HashDictionary(HashDictionary const &other);
+
+    /// @brief Move ctor, leaves 'other' empty
+    HashDictionary(HashDictionary &&other) noexcept;
+
+    /// @brief Copy assignment operator
+    HashDictionary &operator=(HashDictionary const &other);
+
+    /// @brief Move assignment operator, leaves 'other' empty. If the allocator doesn't propagate
+    /// and differs from the one of 'other', elements are copied, so it can throw
+    HashDictionary &operator=(HashDictionary &&other) noexcept(SlotTraits::propagate_on_container_move_assignment::value ||
+                                                               SlotTraits::is_always_equal::value);
+
+    /// @brief Dtor
+    virtual ~HashDictionary();
+
+    /// @return Copy of the allocator
+    Alloc get_allocator() const noexcept { return Alloc(m_slotAlloc); }
+
+    /// @return Count of elements in the dictionary
+    constexpr size_t size() const noexcept { return m_size; }
+
+    /// @brief Checks if container is empty
+    /// @return "true" if empty, ohterwise - "false"
+    constexpr bool empty() const noexcept { return m_size == 0; }
+
+    /// @return Count of slots in the table
+    constexpr size_t capacity() const noexcept { return m_capacity; }
+
+    /// @return Current ratio of count of elements to count of slots
+    float load_factor() const noexcept;
+
+    /// @return Max ratio of count of elements to count of slots
+    constexpr float max_load_factor() const noexcept { return m_maxLoadFactor; }
+
+    /// @brief Sets max load factor, grows the table if it's exceeded now
+    /// @throw Exception "std::invalid_argument" if 'maxLoadFactor' is not in (0, 1]
+    void max_load_factor(float maxLoadFactor);
+
+    /// @brief Allocates enough slots to store 'count' elements without rehashing
+    void reserve(size_t count);
+
+    /// @brief Erasing all elements from the container (memory isn't freed)
+    void clear() noexcept;
+
+    /// @brief Gets a value in dictionary by specified key
+    /// @tparam key key of element that you want to find
+    /// @return Value associated with 'key' parameter
+    /// If there is no specified key in the container
+    /// returns standard null value for 'Value' type
+    virtual const Value &get(Key const &key) const override;
+
+    /// @brief Gets a value in dictionary by specified key
+    /// @throw Exception "std::out_of_range" if there is no key in the container
+    /// @tparam key key of element that you want to find
+    /// @return Value associated with 'key' parameter
+    const Value &at(Key const &key) const;
+
+    /// @brief Modifies value associated with 'key'
+    /// @throw Exception "std::out_of_range" if there is no key in the container
+    /// @tparam key certain key that stores value
+    /// @tparam value new value to set
+    virtual void set(Key const &key, const Value &value) override;
+
+    /// @brief Checks if 'key' stores any element
+    /// @tparam key key which is being checked on availavility of value
+    /// @return "true" if 'key' is associated with some value, otherwise - "false"
+    virtual bool is_set(Key const &key) const override;
+
+    /// @brief Inserting new element to the container. If 'key' already exists, its value is replaced
+    /// @throw Exception "std::overflow_error" if more than ~255 keys have the same hash
+    /// (container isn't changed then)
+    /// @tparam key key to which will be inserted value
+    /// @tparam value value to insert
+    void insert(Key const &key, Value const &value);
+
+    /// @brief Erases element by it key, if there is no such key - does nothing
+    /// @tparam key key to search to erase element
+    void erase(Key const &key);
+};
+
+#endif // HASH_DICTIONARY_HPP
@@ -0,0 +1,403 @@
+#ifndef HASH_DICTIONARY_IMPL_HPP
+#define HASH_DICTIONARY_IMPL_HPP
+
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include "hash_dictionary.hpp"
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+size_t HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::homeSlot(Key const &key, int shift) const noexcept
+{
+    return static_cast<size_t>((static_cast<uint64_t>(m_hash(key)) * 0x9E3779B97F4A7C15ull) >> shift);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+size_t HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::findSlot(Key const &key) const noexcept
+{
+    if (m_size == 0)
+        return m_capacity;
+
+    const size_t mask{m_capacity - 1ul};
+    size_t i{homeSlot(key, m_shift)};
+    for (unsigned distance{1u};; distance++, i = (i + 1ul) & mask)
+    {
+        // Empty slot or element that is closer to its home than 'key' would be -
+        // Robin Hood insertion would have put 'key' here
+        if (m_distances[i] < distance)
+            return m_capacity;
+        if (m_distances[i] == distance && m_equal(m_slots[i].first, key))
+            return i;
+    }
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+bool HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::probe(uint8_t *distances, size_t mask, size_t i, bool place) noexcept
+{
+    uint8_t distance{1u};
+    while (distances[i] != 0)
+    {
+        // Element that is carried on after a swap continues with the distance of the resident one
+        if (distances[i] < distance)
+            distance = place ? std::exchange(distances[i], distance) : distances[i];
+
+        i = (i + 1ul) & mask;
+        if (distance == kMaxDistance)
+            return false;
+        distance++;
+    }
+    if (place)
+        distances[i] = distance;
+    return true;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+void HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::placeNew(Slot &&slot)
+{
+    const size_t mask{m_capacity - 1ul};
+    size_t i{homeSlot(slot.first, m_shift)};
+    uint8_t distance{1u};
+    while (m_distances[i] != 0)
+    {
+        // Resident element is closer to its home - it gives its slot away
+        // and continues probing instead of the new one
+        if (m_distances[i] < distance)
+        {
+            std::swap(slot, m_slots[i]);
+            std::swap(distance, m_distances[i]);
+        }
+
+        i = (i + 1ul) & mask;
+        distance++;
+    }
+    SlotTraits::construct(m_slotAlloc, m_slots + i, std::move(slot));
+    m_distances[i] = distance;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+void HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::rehash(size_t capacity)
+{
+    // Placement of all the elements is tried on distances first, so nothing is moved
+    // until it's known that no probe distance overflows
+    uint8_t *distances{DistanceTraits::allocate(m_distanceAlloc, capacity)};
+    for (;;)
+    {
+        std::memset(distances, 0, capacity);
+        const int shift{64 - std::countr_zero(capacity)};
+        bool fits{true};
+        for (size_t i{}; fits && i < m_capacity; i++)
+            fits = m_distances[i] == 0 || probe(distances, capacity - 1ul, homeSlot(m_slots[i].first, shift), true);
+        if (fits)
+            break;
+
+        DistanceTraits::deallocate(m_distanceAlloc, distances, capacity);
+        // Growing a sparse table won't help - too many keys have the same hash
+        if (m_size * 8ul < capacity)
+            throw std::overflow_error("Exception: std::overflow_error: Too many collisions, hash function is too poor");
+        capacity *= 2ul;
+        distances = DistanceTraits::allocate(m_distanceAlloc, capacity);
+    }
+    std::memset(distances, 0, capacity);
+
+    Slot *oldSlots{m_slots};
+    try
+    {
+        m_slots = SlotTraits::allocate(m_slotAlloc, capacity);
+    }
+    catch (...)
+    {
+        DistanceTraits::deallocate(m_distanceAlloc, distances, capacity);
+        throw;
+    }
+    uint8_t *oldDistances{std::exchange(m_distances, distances)};
+    const size_t oldCapacity{std::exchange(m_capacity, capacity)};
+    m_shift = 64 - std::countr_zero(capacity);
+
+    size_t i{};
+    try
+    {
+        for (; i < oldCapacity; i++)
+            if (oldDistances[i] != 0)
+            {
+                placeNew(std::move(oldSlots[i]));
+                SlotTraits::destroy(m_slotAlloc, oldSlots + i);
+            }
+    }
+    catch (...)
+    {
+        // Only a throwing move of an element gets here. Elements that weren't moved yet are lost,
+        // but the new table stays consistent
+        for (; i < oldCapacity; i++)
+            if (oldDistances[i] != 0)
+                SlotTraits::destroy(m_slotAlloc, oldSlots + i);
+        SlotTraits::deallocate(m_slotAlloc, oldSlots, oldCapacity);
+        DistanceTraits::deallocate(m_distanceAlloc, oldDistances, oldCapacity);
+        m_size = 0;
+        for (size_t j{}; j < m_capacity; j++)
+            m_size += m_distances[j] != 0;
+        throw;
+    }
+
+    if (oldCapacity != 0)
+    {
+        SlotTraits::deallocate(m_slotAlloc, oldSlots, oldCapacity);
+        DistanceTraits::deallocate(m_distanceAlloc, oldDistances, oldCapacity);
+    }
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+void HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::release() noexcept
+{
+    clear();
+    if (m_capacity != 0)
+    {
+        SlotTraits::deallocate(m_slotAlloc, m_slots, m_capacity);
+        DistanceTraits::deallocate(m_distanceAlloc, m_distances, m_capacity);
+    }
+    m_slots = nullptr;
+    m_distances = nullptr;
+    m_capacity = 0;
+    m_shift = 64;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::HashDictionary(float maxLoadFactor)
+{
+    max_load_factor(maxLoadFactor);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::HashDictionary(Alloc const &alloc, float maxLoadFactor)
+    : m_slotAlloc(alloc), m_distanceAlloc(alloc)
+{
+    max_load_factor(maxLoadFactor);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::HashDictionary(HashDictionary const &other)
+    : HashDictionary(other, SlotTraits::select_on_container_copy_construction(other.m_slotAlloc),
+                     DistanceTraits::select_on_container_copy_construction(other.m_distanceAlloc)) {}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::HashDictionary(HashDictionary const &other, SlotAllocator const &slotAlloc,
+                                                                  DistanceAllocator const &distanceAlloc)
+    : m_maxLoadFactor(other.m_maxLoadFactor), m_hash(other.m_hash), m_equal(other.m_equal),
+      m_slotAlloc(slotAlloc), m_distanceAlloc(distanceAlloc)
+{
+    if (other.m_size == 0)
+        return;
+
+    // Same capacity and hash function -> every element goes to the same slot
+    rehash(other.m_capacity);
+    try
+    {
+        for (size_t i{}; i < m_capacity; i++)
+            if (other.m_distances[i] != 0)
+            {
+                SlotTraits::construct(m_slotAlloc, m_slots + i, other.m_slots[i]);
+                m_distances[i] = other.m_distances[i];
+                m_size++;
+            }
+    }
+    catch (...)
+    {
+        release();
+        throw;
+    }
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::HashDictionary(HashDictionary &&other) noexcept
+    : m_slots(std::exchange(other.m_slots, nullptr)), m_distances(std::exchange(other.m_distances, nullptr)),
+      m_capacity(std::exchange(other.m_capacity, 0)), m_size(std::exchange(other.m_size, 0)),
+      m_shift(std::exchange(other.m_shift, 64)), m_maxLoadFactor(other.m_maxLoadFactor),
+      m_hash(std::move(other.m_hash)), m_equal(std::move(other.m_equal)),
+      m_slotAlloc(std::move(other.m_slotAlloc)), m_distanceAlloc(std::move(other.m_distanceAlloc)) {}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+void HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::adopt(HashDictionary &other) noexcept
+{
+    m_slots = std::exchange(other.m_slots, nullptr);
+    m_distances = std::exchange(other.m_distances, nullptr);
+    m_capacity = std::exchange(other.m_capacity, 0);
+    m_size = std::exchange(other.m_size, 0);
+    m_shift = std::exchange(other.m_shift, 64);
+    m_maxLoadFactor = other.m_maxLoadFactor;
+    m_hash = std::move(other.m_hash);
+    m_equal = std::move(other.m_equal);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+HashDictionary<Key, Value, Hash, KeyEqual, Alloc> &
+HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::operator=(HashDictionary const &other)
+{
+    if (this != &other)
+    {
+        // Copy is made with the allocators this dictionary keeps, so its table can be adopted
+        constexpr bool propagate{SlotTraits::propagate_on_container_copy_assignment::value};
+        HashDictionary copy(other, propagate ? other.m_slotAlloc : m_slotAlloc,
+                            propagate ? other.m_distanceAlloc : m_distanceAlloc);
+        release();
+        if constexpr (propagate)
+        {
+            m_slotAlloc = other.m_slotAlloc;
+            m_distanceAlloc = other.m_distanceAlloc;
+        }
+        adopt(copy);
+    }
+    return *this;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+HashDictionary<Key, Value, Hash, KeyEqual, Alloc> &
+HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::operator=(HashDictionary &&other) noexcept(SlotTraits::propagate_on_container_move_assignment::value ||
+                                                                                               SlotTraits::is_always_equal::value)
+{
+    if (this != &other)
+    {
+        // Table from another allocator can't be adopted - copying it
+        if constexpr (!SlotTraits::propagate_on_container_move_assignment::value && !SlotTraits::is_always_equal::value)
+            if (m_slotAlloc != other.m_slotAlloc)
+            {
+                HashDictionary copy(other, m_slotAlloc, m_distanceAlloc);
+                release();
+                adopt(copy);
+                other.release();
+                return *this;
+            }
+
+        release();
+        if constexpr (SlotTraits::propagate_on_container_move_assignment::value)
+        {
+            m_slotAlloc = std::move(other.m_slotAlloc);
+            m_distanceAlloc = std::move(other.m_distanceAlloc);
+        }
+        adopt(other);
+    }
+    return *this;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::~HashDictionary() { release(); }
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+float HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::load_factor() const noexcept
+{
+    return m_capacity == 0 ? 0.0f : static_cast<float>(m_size) / static_cast<float>(m_capacity);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+void HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::max_load_factor(float maxLoadFactor)
+{
+    if (!(maxLoadFactor > 0.0f && maxLoadFactor <= 1.0f))
+        throw std::invalid_argument("Exception: std::invalid_argument: Max load factor has to be in (0, 1]");
+    m_maxLoadFactor = maxLoadFactor;
+    reserve(m_size);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+void HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::reserve(size_t count)
+{
+    if (count == 0)
+        return;
+
+    size_t capacity{m_capacity == 0 ? kMinCapacity : m_capacity};
+    while (static_cast<float>(count) > static_cast<float>(capacity) * m_maxLoadFactor)
+        capacity *= 2ul;
+    if (capacity != m_capacity)
+        rehash(capacity);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+void HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::clear() noexcept
+{
+    for (size_t i{}; i < m_capacity && m_size != 0; i++)
+        if (m_distances[i] != 0)
+        {
+            SlotTraits::destroy(m_slotAlloc, m_slots + i);
+            m_distances[i] = 0;
+            m_size--;
+        }
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+const Value &
+HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::get(Key const &key) const
+{
+    // Returned if there is no such key. It is never modified, so sharing it between threads is safe
+    static const Value null{};
+
+    const size_t i{findSlot(key)};
+    return i != m_capacity ? m_slots[i].second : null;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+const Value &
+HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::at(Key const &key) const
+{
+    const size_t i{findSlot(key)};
+    if (i == m_capacity)
+        throw std::out_of_range("Exception: std::out_of_range: Container does not contains specified key");
+    return m_slots[i].second;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+void HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::set(Key const &key, const Value &value)
+{
+    const size_t i{findSlot(key)};
+    if (i == m_capacity)
+        throw std::out_of_range("Exception: std::out_of_range: Container does not contains specified key");
+    m_slots[i].second = value;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+bool HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::is_set(Key const &key) const
+{
+    return findSlot(key) != m_capacity;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+void HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::insert(Key const &key, Value const &value)
+{
+    if (const size_t i{findSlot(key)}; i != m_capacity)
+    {
+        m_slots[i].second = value;
+        return;
+    }
+
+    reserve(m_size + 1ul);
+    // Table grows until the new element fits, so "placeNew()" never has to stop halfway
+    while (!probe(m_distances, m_capacity - 1ul, homeSlot(key, m_shift), false))
+    {
+        if (m_size * 8ul < m_capacity)
+            throw std::overflow_error("Exception: std::overflow_error: Too many collisions, hash function is too poor");
+        rehash(m_capacity * 2ul);
+    }
+    placeNew(Slot(key, value));
+    m_size++;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Alloc>
+void HashDictionary<Key, Value, Hash, KeyEqual, Alloc>::erase(Key const &key)
+{
+    size_t i{findSlot(key)};
+    if (i == m_capacity)
+        return;
+
+    // Backward shift: following elements that aren't in their home slots move one slot back,
+    // so no tombstone is left and probe sequences stay as short as if 'key' never was inserted
+    const size_t mask{m_capacity - 1ul};
+    SlotTraits::destroy(m_slotAlloc, m_slots + i);
+    for (size_t next{(i + 1ul) & mask}; m_distances[next] > 1u; i = next, next = (next + 1ul) & mask)
+    {
+        SlotTraits::construct(m_slotAlloc, m_slots + i, std::move(m_slots[next]));
+        SlotTraits::destroy(m_slotAlloc, m_slots + next);
+        m_distances[i] = static_cast<uint8_t>(m_distances[next] - 1u);
+    }
+    m_distances[i] = 0;
+    m_size--;
+}
+
+#endif // HASH_DICTIONARY_IMPL_HPP
@@ -0,0 +1,631 @@
+// g++ -std=c++20 -O2 -pthread Vector_test.cpp -o Vector_test
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <typeinfo>
+#include <unistd.h>
+#include <vector>
+
+#include "vector.hpp"
+#include "vector_impl.hpp"
+#include "vector_algorithms.hpp"
+#include "vector_algorithms_impl.hpp"
+#include "small_vector.hpp"
+#include "small_vector_impl.hpp"
+#include "soa_vector.hpp"
+#include "soa_vector_impl.hpp"
+#include "persistent_vector.hpp"
+#include "persistent_vector_impl.hpp"
+
+/// @brief Element that counts live objects and throws from its ctor when asked to
+struct Tracked
+{
+    static inline long alive{};
+
+    std::string value;
+
+    explicit Tracked(std::string const &str, bool fail = false) : value(str)
+    {
+        if (fail)
+            throw std::runtime_error("Tracked(): requested failure");
+        alive++;
+    }
+    Tracked(Tracked const &other) : value(other.value) { alive++; }
+    Tracked(Tracked &&other) noexcept : value(std::move(other.value)) { alive++; }
+    Tracked &operator=(Tracked const &) = default;
+    Tracked &operator=(Tracked &&) noexcept = default;
+    ~Tracked() { alive--; }
+
+    bool operator==(Tracked const &) const = default;
+};
+
+/// @brief Field without default ctor, copying of a negative one throws
+struct Fragile
+{
+    int value;
+
+    explicit Fragile(int v) : value(v) {}
+    Fragile(Fragile const &other) : value(other.value)
+    {
+        if (value < 0)
+            throw std::runtime_error("Fragile(): negative value");
+    }
+    Fragile &operator=(Fragile const &) = default;
+
+    bool operator==(Fragile const &) const = default;
+};
+
+// Appends an element whose ctor throws, the vector has to stay as it was
+template <class Vec>
+static bool emplaceThrowing(Vec &vec, char const *where)
+{
+    const size_t size{vec.size()};
+    try
+    {
+        vec.emplace_back("boom", true);
+        std::cerr << "Failed: emplace_back() " << where << " didn't rethrow" << std::endl;
+        return false;
+    }
+    catch (std::runtime_error const &)
+    {
+    }
+
+    if (vec.size() != size || Tracked::alive != static_cast<long>(size))
+    {
+        std::cerr << "Failed: throwing ctor " << where << " changed the vector: size " << vec.size()
+                  << ", alive " << Tracked::alive << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Throwing ctor: both with spare capacity and on growth, size isn't increased and nothing leaks
+template <class Vec>
+static bool checkThrowingEmplace()
+{
+    bool passed{true};
+    {
+        Vec vec;
+        vec.reserve(4ul);
+        vec.emplace_back("a");
+        vec.emplace_back("b");
+        passed = emplaceThrowing(vec, "with spare capacity") && passed;
+
+        while (vec.size() < vec.capacity())
+            vec.emplace_back(std::to_string(vec.size()));
+        passed = emplaceThrowing(vec, "on growth") && passed;
+
+        // Vector is still usable and its elements are intact
+        vec.emplace_back("c");
+        passed = passed && vec.size() == 5ul && vec.front().value == "a" && vec.back().value == "c";
+    }
+
+    if (Tracked::alive != 0l)
+    {
+        std::cerr << "Failed: " << Tracked::alive << " elements weren't destroyed" << std::endl;
+        return false;
+    }
+    return passed;
+}
+
+// Row whose last field throws: the first column is cut back, columns stay of the same size
+static bool checkSoARollback()
+{
+    bool passed{true};
+    {
+        SoAVector<Tracked, Fragile> soa;
+        soa.push_back(Tracked("a"), Fragile(1));
+
+        Tracked const name("b");
+        Fragile broken(1);
+        broken.value = -1;
+        try
+        {
+            soa.push_back(name, broken);
+            passed = false;
+        }
+        catch (std::runtime_error const &)
+        {
+        }
+
+        passed = passed && soa.size() == 1ul && soa.column<1>().size() == 1ul && Tracked::alive == 2l;
+        passed = passed && soa.at(0ul) == std::tuple<Tracked, Fragile>(Tracked("a"), Fragile(1));
+    }
+
+    if (!passed || Tracked::alive != 0l)
+    {
+        std::cerr << "Failed: throwing field left the columns of SoAVector out of sync" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/// @brief Field whose default ctor throws once 'budget' of default-constructed objects is spent
+struct Scarce
+{
+    static inline int budget{};
+
+    int value;
+
+    Scarce() : value(0)
+    {
+        if (budget-- <= 0)
+            throw std::runtime_error("Scarce(): budget is spent");
+    }
+    explicit Scarce(int v) : value(v) {}
+
+    bool operator==(Scarce const &) const = default;
+};
+
+// Growing "resize()" whose last column throws: columns that already grew are cut back to the old size
+static bool checkSoAResize()
+{
+    SoAVector<std::string, Scarce> soa;
+    soa.push_back(std::string("a"), Scarce(1));
+    soa.push_back(std::string("b"), Scarce(2));
+
+    Scarce::budget = 3;
+    try
+    {
+        soa.resize(10ul);
+        std::cerr << "Failed: resize() of SoAVector didn't rethrow" << std::endl;
+        return false;
+    }
+    catch (std::runtime_error const &)
+    {
+    }
+
+    bool passed{soa.size() == 2ul && soa.column<0>().size() == 2ul && soa.column<1>().size() == 2ul};
+    passed = passed && soa.at(1ul) == std::tuple<std::string, Scarce>("b", Scarce(2));
+
+    Scarce::budget = 2;
+    soa.resize(4ul);
+    passed = passed && soa.column<0>().size() == 4ul && soa.column<1>().size() == 4ul && soa.column<0>()[3].empty();
+
+    if (!passed)
+        std::cerr << "Failed: throwing resize() left the columns of SoAVector out of sync" << std::endl;
+    return passed;
+}
+
+/// @brief Element that counts calls of its move ctor. Declared trivially relocatable below if 'Bitwise' is "true"
+template <bool Bitwise>
+struct Counted
+{
+    static inline size_t moves{};
+
+    int value;
+
+    explicit Counted(int v) : value(v) {}
+    Counted(Counted const &other) : value(other.value) {}
+    Counted(Counted &&other) noexcept : value(other.value) { moves++; }
+    Counted &operator=(Counted const &) = default;
+    ~Counted() {}
+
+    bool operator==(Counted const &) const = default;
+};
+
+template <>
+struct is_trivially_relocatable<Counted<true>> : std::true_type
+{
+};
+
+// Growth of the storage: trivially relocatable elements are moved by "memcpy()", others by their move ctor
+template <bool Bitwise>
+static bool relocatesBitwise()
+{
+    Vector<Counted<Bitwise>> vec;
+    for (int i{0}; i < 1000; i++)
+        vec.emplace_back(i);
+
+    bool intact{vec.size() == 1000ul};
+    for (int i{0}; intact && i < 1000; i++)
+        intact = vec[static_cast<size_t>(i)].value == i;
+    return intact && (Counted<Bitwise>::moves == 0ul) == Bitwise;
+}
+
+static bool checkRelocation()
+{
+    bool passed{relocatesBitwise<true>() && relocatesBitwise<false>()};
+
+    // 'std::unique_ptr' is relocated bitwise too: nothing is freed twice or leaked (see AddressSanitizer)
+    Vector<std::unique_ptr<int>> pointers;
+    for (int i{0}; i < 1000; i++)
+        pointers.push_back(std::make_unique<int>(i));
+    for (int i{0}; passed && i < 1000; i++)
+        passed = *pointers[static_cast<size_t>(i)] == i;
+
+    if (!passed)
+        std::cerr << "Failed: relocation on growth changed the elements or ignored is_trivially_relocatable" << std::endl;
+    return passed;
+}
+
+// Every bulk operation matches its "std::" counterpart, both in the current thread and split across the pool
+static bool bulkMatchesStd(bulk::Execution execution)
+{
+    // Not a multiple of the chunk count, so the last chunk is shorter than the others
+    constexpr size_t kSize{bulk::kParallelThreshold + 12'345ul};
+
+    Vector<long> src;
+    src.reserve(kSize);
+    for (size_t i{0}; i < kSize; i++)
+        src.push_back(static_cast<long>(i * 7ul % 1'000ul));
+
+    Vector<long> copied;
+    bulk::copy(src, copied, execution);
+    bool passed{std::equal(src.begin(), src.end(), copied.begin(), copied.end())};
+
+    Vector<double> halves;
+    bulk::transform(src, halves, [](long value) { return static_cast<double>(value) / 2.0; }, execution);
+    for (size_t i{0}; passed && i < kSize; i++)
+        passed = halves[i] == static_cast<double>(src[i]) / 2.0;
+
+    // Integer sums are exact whatever order the chunks are combined in
+    passed = passed && bulk::reduce(src, 5, std::plus<long>{}, execution) == std::reduce(src.begin(), src.end(), 5l);
+    passed = passed && bulk::reduce(halves, 0, std::plus<double>{}, execution) ==
+                           std::reduce(halves.begin(), halves.end(), 0.0);
+
+    const auto odd{[](long value) { return value % 2l != 0l; }};
+    passed = passed && bulk::count_if(src, odd, execution) ==
+                           static_cast<size_t>(std::count_if(src.begin(), src.end(), odd));
+
+    // First occurrence wins even if a later chunk finds its match first; missing value gives "size()"
+    src[kSize - 10ul] = -1l;
+    src[kSize / 3ul] = -1l;
+    passed = passed && bulk::find(src, -1, execution) == kSize / 3ul && bulk::find(src, 1'000, execution) == kSize;
+
+    // Literal of another type is converted to the element type
+    bulk::fill(halves, 0, execution);
+    passed = passed && std::all_of(halves.begin(), halves.end(), [](double value) { return value == 0.0; });
+
+    Vector<long> empty;
+    passed = passed && bulk::reduce(empty, 3, std::plus<long>{}, execution) == 3l && bulk::find(empty, 0, execution) == 0ul;
+    return passed;
+}
+
+static bool checkBulk()
+{
+    const bool passed{bulkMatchesStd(bulk::Execution::Sequential) && bulkMatchesStd(bulk::Execution::Parallel) &&
+                      bulkMatchesStd(bulk::Execution::Auto)};
+    if (!passed)
+        std::cerr << "Failed: bulk operations differ from the standard algorithms" << std::endl;
+    return passed;
+}
+
+/// @brief Single-pass view of an array: satisfies "std::input_iterator" but not "std::forward_iterator"
+template <typename T>
+struct SinglePass
+{
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+
+    T const *ptr{};
+
+    T const &operator*() const { return *ptr; }
+    SinglePass &operator++()
+    {
+        ++ptr;
+        return *this;
+    }
+    void operator++(int) { ++ptr; }
+    bool operator==(SinglePass const &) const = default;
+};
+
+// Inserts the range before the middle element, then checks the result and that a throwing copy undoes it
+template <typename It>
+static bool insertsRange(It first, It last, It brokenFirst, It brokenLast, std::vector<Fragile> const &source)
+{
+    Vector<Fragile> vec;
+    for (int value : {100, 200, 300})
+        vec.emplace_back(value);
+
+    Vector<Fragile>::iterator inserted{vec.insert(vec.begin() + 1, first, last)};
+    bool passed{inserted == vec.begin() + 1 && vec.size() == source.size() + 3ul};
+    passed = passed && vec.front().value == 100 && std::equal(source.begin(), source.end(), inserted) &&
+             vec[source.size() + 1ul].value == 200 && vec.back().value == 300;
+
+    vec.append(first, last);
+    passed = passed && vec.size() == 2ul * source.size() + 3ul &&
+             std::equal(source.begin(), source.end(), vec.end() - static_cast<std::ptrdiff_t>(source.size()));
+
+    // Range with a negative element in the middle: nothing is added
+    const size_t size{vec.size()};
+    try
+    {
+        vec.insert(vec.begin(), brokenFirst, brokenLast);
+        passed = false;
+    }
+    catch (std::runtime_error const &)
+    {
+    }
+    try
+    {
+        vec.append(brokenFirst, brokenLast);
+        passed = false;
+    }
+    catch (std::runtime_error const &)
+    {
+    }
+    return passed && vec.size() == size && vec.front().value == 100 && vec.back().value == source.back().value;
+}
+
+// Range insertion of forward and single-pass ranges, including one from a stream
+static bool checkRangeInsert()
+{
+    std::vector<Fragile> source;
+    for (int value{1}; value <= 50; value++)
+        source.emplace_back(value);
+    std::vector<Fragile> broken(source);
+    broken[25].value = -1;
+
+    Fragile const *begin{source.data()}, *end{source.data() + source.size()};
+    Fragile const *brokenBegin{broken.data()}, *brokenEnd{broken.data() + broken.size()};
+    bool passed{insertsRange(begin, end, brokenBegin, brokenEnd, source)};
+
+    // The same ranges through a single-pass iterator, which grows the vector one element at a time
+    using Single = SinglePass<Fragile>;
+    passed = passed && insertsRange(Single{begin}, Single{end}, Single{brokenBegin}, Single{brokenEnd}, source);
+
+    std::istringstream stream("4 5 6");
+    Vector<int> numbers;
+    numbers.push_back(1);
+    numbers.push_back(7);
+    numbers.insert(numbers.begin() + 1, std::istream_iterator<int>(stream), std::istream_iterator<int>());
+    const int expected[]{1, 4, 5, 6, 7};
+    passed = passed && std::equal(numbers.begin(), numbers.end(), std::begin(expected), std::end(expected));
+
+    if (!passed)
+        std::cerr << "Failed: range insert() or append() put wrong elements or didn't undo a throwing copy" << std::endl;
+    return passed;
+}
+
+// Appends elements one by one and collects every capacity the vector grows to, each step has to follow 'Policy'
+template <class Policy>
+static bool growsBy(std::initializer_list<size_t> expected, size_t count = 20'000ul)
+{
+    Vector<int, std::allocator<int>, Policy> vec;
+    std::vector<size_t> capacities;
+    bool passed{true};
+    for (size_t i{0}; i < count; i++)
+    {
+        const size_t capacity{vec.capacity()};
+        vec.push_back(static_cast<int>(i));
+        if (vec.capacity() == capacity)
+            continue;
+        passed = passed && vec.capacity() == std::max(vec.size(), Policy::template next<int>(capacity, vec.size()));
+        capacities.push_back(vec.capacity());
+    }
+
+    for (size_t i{0}; passed && i < count; i++)
+        passed = vec[i] == static_cast<int>(i);
+    return passed && capacities.size() >= expected.size() &&
+           std::equal(expected.begin(), expected.end(), capacities.begin());
+}
+
+// Page aligned storage of large vectors holds a whole number of pages
+static bool pageAligned()
+{
+    using Policy = PageAlignedGrowth<4096ul, 1ul << 14>;
+    Vector<int, std::allocator<int>, Policy> vec;
+    bool passed{growsBy<Policy>({1ul, 2ul, 4ul, 8ul})};
+    for (int i{0}; i < 20'000; i++)
+    {
+        vec.push_back(i);
+        if (vec.capacity() * sizeof(int) > (1ul << 14))
+            passed = passed && vec.capacity() * sizeof(int) % 4096ul == 0ul;
+    }
+    return passed;
+}
+
+// Capacity after growth, "reserve()" and "shrink_to_fit()"
+static bool checkCapacity()
+{
+    bool passed{growsBy<DoublingGrowth>({1ul, 2ul, 4ul, 8ul, 16ul, 32ul})};
+    passed = passed && growsBy<OneAndHalfGrowth>({1ul, 2ul, 3ul, 4ul, 6ul, 9ul, 13ul, 19ul});
+    passed = passed && growsBy<FixedChunkGrowth<16ul>>({16ul, 32ul, 48ul, 64ul}, 2'000ul);
+    passed = passed && pageAligned();
+
+    // "reserve()" allocates exactly the requested capacity and never shrinks
+    Vector<int> vec;
+    vec.reserve(100ul);
+    passed = passed && vec.capacity() == 100ul && vec.empty();
+    for (int i{0}; i < 10; i++)
+        vec.push_back(i);
+    vec.reserve(5ul);
+    passed = passed && vec.capacity() == 100ul && vec.size() == 10ul;
+    try
+    {
+        vec.reserve(vec.max_size() + 1ul);
+        passed = false;
+    }
+    catch (std::length_error const &)
+    {
+    }
+    passed = passed && vec.capacity() == 100ul && vec.size() == 10ul;
+
+    // "shrink_to_fit()" keeps the elements, empty vector releases its storage
+    vec.shrink_to_fit();
+    passed = passed && vec.capacity() == 10ul && vec.front() == 0 && vec.back() == 9;
+    vec.clear();
+    vec.shrink_to_fit();
+    passed = passed && vec.capacity() == 0ul && vec.empty();
+    vec.push_back(1);
+    passed = passed && vec.size() == 1ul && vec.front() == 1;
+
+    // Non-trivially relocatable elements are moved to the smaller storage too
+    Vector<std::string> strings;
+    strings.reserve(64ul);
+    for (int i{0}; i < 20; i++)
+        strings.push_back(std::to_string(i));
+    strings.shrink_to_fit();
+    passed = passed && strings.capacity() == 20ul && strings.front() == "0" && strings.back() == "19";
+
+    if (!passed)
+        std::cerr << "Failed: capacity doesn't follow the growth policy, reserve() or shrink_to_fit()" << std::endl;
+    return passed;
+}
+
+/// @brief Allocator that can't provide storage for more than 'Limit' elements
+template <typename T, size_t Limit = 6ul>
+struct LimitedAllocator : std::allocator<T>
+{
+    template <typename U>
+    struct rebind
+    {
+        using other = LimitedAllocator<U, Limit>;
+    };
+
+    LimitedAllocator() noexcept = default;
+    template <typename U>
+    LimitedAllocator(LimitedAllocator<U, Limit> const &) noexcept {}
+
+    size_t max_size() const noexcept { return Limit; }
+};
+
+// "max_size()" comes from the allocator: growth stops at it and the next element is refused
+static bool checkMaxSize()
+{
+    Vector<int, LimitedAllocator<int>> vec;
+    bool passed{vec.max_size() == 6ul && Vector<int>().max_size() > static_cast<size_t>(std::numeric_limits<int>::max())};
+    for (int i{0}; i < 6; i++)
+        vec.push_back(i);
+    // Doubling would give 8, but the capacity is cut to the limit
+    passed = passed && vec.capacity() == 6ul;
+    try
+    {
+        vec.push_back(6);
+        passed = false;
+    }
+    catch (std::length_error const &)
+    {
+    }
+    passed = passed && vec.size() == 6ul && vec.back() == 5;
+
+    if (!passed)
+        std::cerr << "Failed: max_size() of the allocator isn't respected" << std::endl;
+    return passed;
+}
+
+// Read-only opening of the file as a vector of 'T' has to fail with exactly 'Error'
+template <typename Error, typename T = int>
+static bool rejects(std::filesystem::path const &path)
+{
+    try
+    {
+        PersistentVector<T> vec(path.string(), PersistentVector<T>::Mode::ReadOnly);
+        return false;
+    }
+    catch (Error const &error)
+    {
+        return typeid(error) == typeid(Error);
+    }
+}
+
+// File survives reopening, read-only vector can't change it and doesn't read past its mapping when a writer grows it
+static bool checkPersistent()
+{
+    using Mode = PersistentVector<int>::Mode;
+    const std::filesystem::path dir{std::filesystem::temp_directory_path() / ("vector_test_" + std::to_string(getpid()))};
+    std::filesystem::create_directories(dir);
+    const std::filesystem::path path{dir / "numbers.pvec"};
+
+    bool passed{true};
+    {
+        PersistentVector<int> vec(path.string());
+        for (int i{0}; i < 100; i++)
+            vec.push_back(i);
+        const int more[]{100, 101, 102};
+        vec.append(std::begin(more), std::end(more));
+        vec.sync();
+    }
+    {
+        PersistentVector<int> const reader(path.string(), Mode::ReadOnly);
+        passed = reader.size() == 103ul && reader.front() == 0 && reader.back() == 102;
+        for (size_t i{0}; passed && i < reader.size(); i++)
+            passed = reader.at(i) == static_cast<int>(i);
+    }
+
+    {
+        PersistentVector<int> reader(path.string(), Mode::ReadOnly);
+        const size_t mapped{reader.capacity()};
+        try
+        {
+            reader.push_back(1);
+            passed = false;
+        }
+        catch (std::logic_error const &)
+        {
+        }
+
+        // Writer grows the file far beyond the reader's mapping, reader sees only what it has mapped
+        PersistentVector<int> writer(path.string());
+        for (int i{103}; i < 10'000; i++)
+            writer.push_back(i);
+        passed = passed && reader.size() == mapped && reader.capacity() == mapped &&
+                 reader.back() == static_cast<int>(mapped) - 1;
+        passed = passed && std::span<int const>(reader).size() == mapped && reader.end() == reader.data() + mapped;
+
+        // Reopened reader maps the grown file
+        PersistentVector<int> const reopened(path.string(), Mode::ReadOnly);
+        passed = passed && reopened.size() == 10'000ul && reopened.back() == 9'999;
+    }
+
+    // Header of another element type, garbage, truncated file and missing file
+    passed = passed && rejects<std::runtime_error, long>(path);
+    {
+        std::ofstream garbage(dir / "garbage.pvec", std::ios::binary);
+        garbage << std::string(256ul, 'x');
+    }
+    passed = passed && rejects<std::runtime_error>(dir / "garbage.pvec");
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) / 2ul);
+    passed = passed && rejects<std::runtime_error>(path);
+    passed = passed && rejects<std::system_error>(dir / "missing.pvec");
+
+    std::filesystem::remove_all(dir);
+    if (!passed)
+        std::cerr << "Failed: persistent vector lost elements or opened a foreign file" << std::endl;
+    return passed;
+}
+
+int main()
+{
+    if (!checkThrowingEmplace<Vector<Tracked>>())
+        return EXIT_FAILURE;
+
+    // Inline storage of 4 elements, growth moves them to the heap
+    if (!checkThrowingEmplace<SmallVector<Tracked, 4ul>>())
+        return EXIT_FAILURE;
+
+    if (!checkSoARollback() || !checkSoAResize())
+        return EXIT_FAILURE;
+
+    if (!checkRelocation())
+        return EXIT_FAILURE;
+
+    if (!checkBulk())
+        return EXIT_FAILURE;
+
+    if (!checkRangeInsert())
+        return EXIT_FAILURE;
+
+    if (!checkCapacity())
+        return EXIT_FAILURE;
+
+    if (!checkMaxSize())
+        return EXIT_FAILURE;
+
+    if (!checkPersistent())
+        return EXIT_FAILURE;
+
+    std::cout << "Passed" << std::endl;
+    return EXIT_SUCCESS;
+}
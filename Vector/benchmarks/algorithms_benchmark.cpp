@@ -0,0 +1,114 @@
+// g++ -std=c++20 -O3 benchmarks/algorithms_benchmark.cpp -o algorithms_benchmark -ltbb
+#include <algorithm>
+#include <chrono>
+#include <execution>
+#include <iomanip>
+#include <numeric>
+#include <string>
+
+#include "../vector_algorithms.hpp"
+#include "../vector_algorithms_impl.hpp"
+
+/// @return Best time of 3 runs of 'fn' in milliseconds
+template <typename Fn>
+double measure(Fn fn)
+{
+    double best{std::numeric_limits<double>::max()};
+    for (int run{}; run < 3; run++)
+    {
+        const auto start{std::chrono::steady_clock::now()};
+        fn();
+        const std::chrono::duration<double, std::milli> elapsed{std::chrono::steady_clock::now() - start};
+        best = std::min(best, elapsed.count());
+    }
+    return best;
+}
+
+/// @brief Prints a row of the table: plain loop through "operator[]", bulk (sequential|parallel), std::execution::par_unseq
+template <typename Loop, typename Sequential, typename Parallel, typename Std>
+void row(std::string const &name, size_t size, Loop loop, Sequential sequential, Parallel parallel, Std std)
+{
+    std::cout << std::setw(10) << name << std::setw(14) << size << std::setw(12) << measure(loop)
+              << std::setw(12) << measure(sequential) << std::setw(12) << measure(parallel)
+              << std::setw(12) << measure(std) << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t maxSize{argc > 1 ? std::stoul(argv[1]) : 100'000'000ul};
+
+    std::cout << "AVX2: " << (bulk::detail::hasAvx2() ? "yes" : "no")
+              << ", threads: " << bulk::detail::ThreadPool::instance().concurrency() << ", time in ms" << std::endl;
+    std::cout << std::setw(10) << "operation" << std::setw(14) << "elements" << std::setw(12) << "loop"
+              << std::setw(12) << "bulk seq" << std::setw(12) << "bulk par" << std::setw(12) << "par_unseq" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    volatile double sink{};
+    volatile size_t index{};
+    for (size_t size{1'000'000ul}; size <= maxSize; size *= 10ul)
+    {
+        Vector<double> src, dst;
+        src.resize(size);
+        dst.resize(size);
+        for (size_t i{}; i < size; i++)
+            src[i] = static_cast<double>(i % 1000ul);
+        double *const first{&src[0]}, *const last{first + size}, *const out{&dst[0]};
+        const double missing{-1.0};
+        const auto scale{[](double x)
+                         { return x * 1.5 + 2.0; }};
+        const auto big{[](double x)
+                       { return x > 500.0; }};
+        using bulk::Execution;
+
+        row("fill", size, [&]()
+            { for (size_t i{}; i < size; i++) dst[i] = 1.0; },
+            [&]()
+            { bulk::fill(dst, 1.0, Execution::Sequential); },
+            [&]()
+            { bulk::fill(dst, 1.0, Execution::Parallel); },
+            [&]()
+            { std::fill(std::execution::par_unseq, out, out + size, 1.0); });
+        row("copy", size, [&]()
+            { for (size_t i{}; i < size; i++) dst[i] = src[i]; },
+            [&]()
+            { bulk::copy(src, dst, Execution::Sequential); },
+            [&]()
+            { bulk::copy(src, dst, Execution::Parallel); },
+            [&]()
+            { std::copy(std::execution::par_unseq, first, last, out); });
+        row("transform", size, [&]()
+            { for (size_t i{}; i < size; i++) dst[i] = scale(src[i]); },
+            [&]()
+            { bulk::transform(src, dst, scale, Execution::Sequential); },
+            [&]()
+            { bulk::transform(src, dst, scale, Execution::Parallel); },
+            [&]()
+            { std::transform(std::execution::par_unseq, first, last, out, scale); });
+        row("reduce", size, [&]()
+            { double sum{}; for (size_t i{}; i < size; i++) sum += src[i]; sink = sum; },
+            [&]()
+            { sink = bulk::reduce(src, 0.0, std::plus<double>{}, Execution::Sequential); },
+            [&]()
+            { sink = bulk::reduce(src, 0.0, std::plus<double>{}, Execution::Parallel); },
+            [&]()
+            { sink = std::reduce(std::execution::par_unseq, first, last, 0.0); });
+        row("count_if", size, [&]()
+            { size_t count{}; for (size_t i{}; i < size; i++) count += big(src[i]); index = count; },
+            [&]()
+            { index = bulk::count_if(src, big, Execution::Sequential); },
+            [&]()
+            { index = bulk::count_if(src, big, Execution::Parallel); },
+            [&]()
+            { index = static_cast<size_t>(std::count_if(std::execution::par_unseq, first, last, big)); });
+        row("find", size, [&]()
+            { size_t i{}; while (i < size && src[i] != missing) i++; index = i; },
+            [&]()
+            { index = bulk::find(src, missing, Execution::Sequential); },
+            [&]()
+            { index = bulk::find(src, missing, Execution::Parallel); },
+            [&]()
+            { index = static_cast<size_t>(std::find(std::execution::par_unseq, first, last, missing) - first); });
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,53 @@
+// g++ -std=c++20 -O3 benchmarks/append_benchmark.cpp -o append_benchmark
+#include <chrono>
+#include <iomanip>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "../vector.hpp"
+#include "../vector_impl.hpp"
+
+/**
+ * @brief Builds a vector of at least 'total' elements out of copies of 'source'
+ * @param bulk "true" to add each batch with "append()", "false" to add it with "push_back()" one by one
+ * @return Elapsed time in milliseconds
+ */
+double run(std::vector<int> const &source, size_t total, bool bulk)
+{
+    const auto start{std::chrono::steady_clock::now()};
+
+    Vector<int> vec;
+    long batches{};
+    for (size_t added{}; added < total; added += source.size(), batches++)
+        if (bulk)
+            vec.append(source.begin(), source.end());
+        else
+            for (int value : source)
+                vec.push_back(value);
+
+    const std::chrono::duration<double, std::milli> elapsed{std::chrono::steady_clock::now() - start};
+    if (std::accumulate(vec.begin(), vec.end(), 0l) != batches * std::accumulate(source.begin(), source.end(), 0l))
+        std::cerr << "Checksum mismatch" << std::endl;
+    return elapsed.count();
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t total{argc > 1 ? std::stoul(argv[1]) : 100'000'000ul};
+
+    std::cout << "Elements: " << total << std::endl;
+    std::cout << std::setw(10) << "batch" << std::setw(18) << "push_back, ms" << std::setw(16) << "append, ms" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    for (size_t batch : {16ul, 1024ul, 65536ul, total})
+    {
+        std::vector<int> source(batch);
+        std::iota(source.begin(), source.end(), 0);
+        const double pushBackMs{run(source, total, false)};
+        const double appendMs{run(source, total, true)};
+        std::cout << std::setw(10) << batch << std::setw(18) << pushBackMs << std::setw(16) << appendMs << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,62 @@
+// g++ -std=c++20 -O3 benchmarks/emplace_benchmark.cpp -o emplace_benchmark
+#include <chrono>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#include "../vector.hpp"
+#include "../vector_impl.hpp"
+
+/// @brief Element with an expensive default ctor: allocates and fills a table
+struct Heavy
+{
+    static inline size_t defaultCtors{};
+
+    std::string name;
+    std::vector<double> weights;
+
+    Heavy() : weights(64ul, 1.0) { defaultCtors++; }
+    Heavy(size_t id, double weight) : name("heavy #" + std::to_string(id)), weights(64ul, weight) {}
+
+    bool operator==(Heavy const &) const = default;
+};
+
+/**
+ * @brief Fills container with 'count' elements via "emplace_back()"
+ * @return Elapsed time in milliseconds
+ */
+template <class Container>
+double run(size_t count)
+{
+    Heavy::defaultCtors = 0ul;
+    const auto start{std::chrono::steady_clock::now()};
+
+    Container container;
+    for (size_t i{}; i < count; i++)
+        container.emplace_back(i, static_cast<double>(i));
+
+    const std::chrono::duration<double, std::milli> elapsed{std::chrono::steady_clock::now() - start};
+    if (container.size() != count || container[count - 1].weights.front() != static_cast<double>(count - 1))
+        std::cerr << "Wrong content of the container" << std::endl;
+    return elapsed.count();
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t count{argc > 1 ? std::stoul(argv[1]) : 1'000'000ul};
+
+    std::cout << "Elements: " << count << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    run<Vector<Heavy>>(count); // warm-up of the heap
+    const double vectorMs{run<Vector<Heavy>>(count)};
+    const size_t vectorDefaultCtors{Heavy::defaultCtors};
+    const double stdVectorMs{run<std::vector<Heavy>>(count)};
+    const size_t stdVectorDefaultCtors{Heavy::defaultCtors};
+
+    std::cout << std::setw(14) << "container" << std::setw(12) << "ms" << std::setw(16) << "default ctors" << '\n'
+              << std::setw(14) << "Vector" << std::setw(12) << vectorMs << std::setw(16) << vectorDefaultCtors << '\n'
+              << std::setw(14) << "std::vector" << std::setw(12) << stdVectorMs << std::setw(16) << stdVectorDefaultCtors << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,93 @@
+// g++ -std=c++20 -O3 benchmarks/growth_policy_benchmark.cpp -o growth_policy_benchmark
+#include <chrono>
+#include <iomanip>
+#include <string>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "../vector.hpp"
+#include "../vector_impl.hpp"
+
+/// @brief Standard allocator that counts allocations (every allocation of a growing vector is a reallocation)
+template <typename T>
+struct CountingAllocator : std::allocator<T>
+{
+    static inline size_t allocations{};
+
+    template <typename U>
+    struct rebind
+    {
+        using other = CountingAllocator<U>;
+    };
+
+    CountingAllocator() = default;
+    template <typename U>
+    CountingAllocator(CountingAllocator<U> const &) noexcept {}
+
+    T *allocate(size_t n)
+    {
+        allocations++;
+        return std::allocator<T>::allocate(n);
+    }
+};
+
+/// @return Peak resident set size of the current process in MiB
+double peakRssMiB()
+{
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<double>(usage.ru_maxrss) / 1024.0;
+}
+
+/**
+ * @brief Appends 'count' doubles one by one in a separate process, so every policy starts with a fresh peak RSS,
+ * then prints a row of the table
+ */
+template <class Policy>
+void run(std::string const &name, size_t count)
+{
+    std::cout.flush();
+    const pid_t pid{fork()};
+    if (pid != 0)
+    {
+        waitpid(pid, nullptr, 0);
+        return;
+    }
+
+    const double baseRss{peakRssMiB()};
+    const auto start{std::chrono::steady_clock::now()};
+
+    Vector<double, CountingAllocator<double>, Policy> vec;
+    for (size_t i{}; i < count; i++)
+        vec.push_back(static_cast<double>(i));
+
+    const std::chrono::duration<double, std::milli> elapsed{std::chrono::steady_clock::now() - start};
+    const double peakRss{peakRssMiB() - baseRss};
+    const double unused{static_cast<double>(vec.capacity() - vec.size()) * sizeof(double) / 1024.0 / 1024.0};
+    const size_t reallocations{CountingAllocator<double>::allocations};
+    // Returns the unused tail, "_exit()" status tells if it worked
+    vec.shrink_to_fit();
+
+    std::cout << std::setw(22) << name << std::setw(16) << reallocations
+              << std::setw(16) << peakRss << std::setw(14) << unused
+              << std::setw(12) << elapsed.count() << std::endl;
+    _exit(vec.capacity() == count ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t count{argc > 1 ? std::stoul(argv[1]) : 50'000'000ul};
+
+    std::cout << "Elements: " << count << " doubles (" << count * sizeof(double) / 1024ul / 1024ul << " MiB)" << std::endl;
+    std::cout << std::setw(22) << "policy" << std::setw(16) << "reallocations" << std::setw(16) << "peak RSS, MiB"
+              << std::setw(14) << "unused, MiB" << std::setw(12) << "ms" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    run<DoublingGrowth>("2x", count);
+    run<OneAndHalfGrowth>("1.5x", count);
+    run<FixedChunkGrowth<1ul << 20>>("fixed 1M elements", count);
+    run<PageAlignedGrowth<>>("page aligned 1.5x", count);
+
+    return EXIT_SUCCESS;
+}
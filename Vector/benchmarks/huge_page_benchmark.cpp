@@ -0,0 +1,81 @@
+// g++ -std=c++20 -O3 benchmarks/huge_page_benchmark.cpp -o huge_page_benchmark
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <string>
+
+#include "../vector.hpp"
+#include "../vector_impl.hpp"
+#include "../huge_page_allocator.hpp"
+#include "../huge_page_allocator_impl.hpp"
+
+/// @return Amount of anonymous memory of the process backed by transparent huge pages in MiB
+double anonHugePagesMiB()
+{
+    std::ifstream smaps("/proc/self/smaps_rollup");
+    std::string key;
+    double kb{};
+    while (smaps >> key)
+        if (key == "AnonHugePages:" && smaps >> kb)
+            return kb / 1024.0;
+    return 0.0;
+}
+
+/// @return Elapsed time of 'fn' in milliseconds
+template <typename Fn>
+double measure(Fn fn)
+{
+    const auto start{std::chrono::steady_clock::now()};
+    fn();
+    const std::chrono::duration<double, std::milli> elapsed{std::chrono::steady_clock::now() - start};
+    return elapsed.count();
+}
+
+/// @brief Grows the vector with "push_back()", then scans it sequentially and reads it at random indices
+template <class Allocator>
+void run(std::string const &name, size_t count, size_t reads)
+{
+    Vector<double, Allocator> vec;
+    volatile double sink{};
+
+    const double growMs{measure([&]()
+                                { for (size_t i{}; i < count; i++) vec.push_back(static_cast<double>(i)); })};
+    const double hugeMiB{anonHugePagesMiB()};
+    const double scanMs{measure([&]()
+                                {
+        double sum{};
+        for (double value : vec)
+            sum += value;
+        sink = sum; })};
+    const double randomMs{measure([&]()
+                                  {
+        // Indices come from a linear congruential generator: cheap and not predictable by the prefetcher
+        double sum{};
+        uint64_t state{42ul};
+        for (size_t i{}; i < reads; i++)
+        {
+            state = state * 6364136223846793005ul + 1442695040888963407ul;
+            sum += vec[(state >> 16) % count];
+        }
+        sink = sum; })};
+
+    std::cout << std::setw(12) << name << std::setw(12) << growMs << std::setw(12) << scanMs
+              << std::setw(14) << randomMs << std::setw(18) << hugeMiB << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t count{argc > 1 ? std::stoul(argv[1]) : 128'000'000ul};
+    const size_t reads{argc > 2 ? std::stoul(argv[2]) : 50'000'000ul};
+
+    std::cout << "Elements: " << count << " doubles (" << count * sizeof(double) / 1024ul / 1024ul
+              << " MiB), random reads: " << reads << ", time in ms" << std::endl;
+    std::cout << std::setw(12) << "storage" << std::setw(12) << "push_back" << std::setw(12) << "scan"
+              << std::setw(14) << "random read" << std::setw(18) << "huge pages, MiB" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    run<std::allocator<double>>("std", count, reads);
+    run<HugePageAllocator<double>>("huge pages", count, reads);
+
+    return EXIT_SUCCESS;
+}
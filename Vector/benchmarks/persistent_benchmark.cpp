@@ -0,0 +1,96 @@
+// g++ -std=c++20 -O3 benchmarks/persistent_benchmark.cpp -o persistent_benchmark
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <optional>
+#include <string>
+
+#include "../vector.hpp"
+#include "../vector_impl.hpp"
+#include "../persistent_vector.hpp"
+#include "../persistent_vector_impl.hpp"
+
+/// @brief Row of the lookup table, computing it takes some work like in a real table
+struct Entry
+{
+    uint64_t key;
+    uint64_t hash;
+    double weight;
+    double score;
+
+    bool operator==(Entry const &) const = default;
+};
+
+Entry makeEntry(uint64_t key)
+{
+    uint64_t hash{key};
+    for (int round{}; round < 8; round++)
+    {
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdul;
+        hash ^= hash >> 29;
+    }
+    const double weight{std::sqrt(static_cast<double>(hash % 1'000'003ul))};
+    return {key, hash, weight, std::log1p(weight) * std::sin(weight)};
+}
+
+/// @return Elapsed time of 'fn' in milliseconds
+template <typename Fn>
+double measure(Fn fn)
+{
+    const auto start{std::chrono::steady_clock::now()};
+    fn();
+    const std::chrono::duration<double, std::milli> elapsed{std::chrono::steady_clock::now() - start};
+    return elapsed.count();
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t count{argc > 1 ? std::stoul(argv[1]) : 20'000'000ul};
+    const std::string path{argc > 2 ? argv[2] : "/tmp/persistent_vector_benchmark.bin"};
+    std::remove(path.c_str());
+
+    std::cout << "Entries: " << count << " (" << count * sizeof(Entry) / 1024ul / 1024ul << " MiB), file: " << path << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+
+    // Startup without the file: the table is computed from scratch
+    Vector<Entry> table;
+    const double rebuildMs{measure([&]()
+                                   {
+        table.reserve(count);
+        for (uint64_t key{}; key < count; key++)
+            table.push_back(makeEntry(key)); })};
+
+    // One-off: the table is saved, "sync()" waits for the disk
+    const double saveMs{measure([&]()
+                                {
+        PersistentVector<Entry> file(path);
+        file.clear();
+        file.append(table.begin(), table.end());
+        file.sync(); })};
+
+    // Startup with the file: mapping only, pages are loaded on first access (from the page cache if it's warm)
+    volatile uint64_t sink{};
+    double openMs{}, scanMs{};
+    {
+        std::optional<PersistentVector<Entry>> opened;
+        openMs = measure([&]()
+                         { opened.emplace(path, PersistentVector<Entry>::Mode::ReadOnly); });
+        scanMs = measure([&]()
+                         {
+            uint64_t sum{};
+            for (Entry const &entry : *opened)
+                sum += entry.hash;
+            sink = sum; });
+        if (opened->size() != count || (*opened)[count / 2ul] != table[count / 2ul])
+            std::cerr << "Loaded table differs from the built one" << std::endl;
+    }
+
+    std::cout << "rebuild:               " << rebuildMs << " ms" << std::endl;
+    std::cout << "save + sync (once):    " << saveMs << " ms" << std::endl;
+    std::cout << "open read-only:        " << openMs << " ms" << std::endl;
+    std::cout << "first full scan:       " << scanMs << " ms" << std::endl;
+
+    std::remove(path.c_str());
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,54 @@
+// g++ -std=c++20 -O3 benchmarks/relocation_benchmark.cpp -o relocation_benchmark
+#include <chrono>
+#include <iomanip>
+#include <string>
+
+#include "../vector.hpp"
+#include "../vector_impl.hpp"
+
+/// @brief Owning handle, the same layout in both variants. Only the trait differs
+template <bool Relocatable>
+struct Handle
+{
+    std::unique_ptr<int> ptr;
+
+    bool operator==(Handle const &) const = default;
+};
+
+template <>
+struct is_trivially_relocatable<Handle<true>> : std::true_type
+{
+};
+
+/**
+ * @brief Pushes 'count' elements one by one, capacity grows from zero
+ * @return Millions of elements per second
+ */
+template <typename T>
+double run(size_t count)
+{
+    const auto start{std::chrono::steady_clock::now()};
+    {
+        Vector<T> vec;
+        for (size_t i{}; i < count; i++)
+            vec.push_back(T{});
+    }
+    const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+    return static_cast<double>(count) / elapsed.count() / 1e6;
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t count{argc > 1 ? std::stoul(argv[1]) : 100'000'000ul};
+
+    static_assert(is_trivially_relocatable_v<int> && is_trivially_relocatable_v<std::unique_ptr<int>>);
+    static_assert(!is_trivially_relocatable_v<Handle<false>> && !is_trivially_relocatable_v<std::string>);
+
+    std::cout << "Elements: " << count << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "element-wise move (Handle<false>): " << run<Handle<false>>(count) << " M push_back/s" << std::endl;
+    std::cout << "memcpy relocation (Handle<true>):  " << run<Handle<true>>(count) << " M push_back/s" << std::endl;
+    std::cout << "memcpy relocation (int):           " << run<int>(count) << " M push_back/s" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,80 @@
+// g++ -std=c++20 -O3 benchmarks/small_vector_benchmark.cpp -o small_vector_benchmark
+#include <chrono>
+#include <iomanip>
+#include <string>
+
+#include "../vector.hpp"
+#include "../vector_impl.hpp"
+#include "../small_vector.hpp"
+#include "../small_vector_impl.hpp"
+
+/// @brief Standard allocator that counts heap allocations
+template <typename T>
+struct CountingAllocator : std::allocator<T>
+{
+    static inline size_t allocations{};
+
+    template <typename U>
+    struct rebind
+    {
+        using other = CountingAllocator<U>;
+    };
+
+    CountingAllocator() = default;
+    template <typename U>
+    CountingAllocator(CountingAllocator<U> const &) noexcept {}
+
+    T *allocate(size_t n)
+    {
+        allocations++;
+        return std::allocator<T>::allocate(n);
+    }
+};
+
+/**
+ * @brief Creates 'count' vectors of 'elements' elements each
+ * @param ns nanoseconds per vector
+ * @return Heap allocations per vector
+ */
+template <class Container>
+double run(size_t count, size_t elements, double &ns)
+{
+    CountingAllocator<int>::allocations = 0ul;
+    size_t checksum{};
+
+    const auto start{std::chrono::steady_clock::now()};
+    for (size_t i{}; i < count; i++)
+    {
+        Container vec;
+        for (size_t j{}; j < elements; j++)
+            vec.push_back(static_cast<int>(i + j));
+        checksum += static_cast<size_t>(vec.back());
+    }
+    const std::chrono::duration<double, std::nano> elapsed{std::chrono::steady_clock::now() - start};
+
+    if (elements && checksum != count * (count - 1ul) / 2ul + count * (elements - 1ul))
+        std::cerr << "Checksum mismatch" << std::endl;
+    ns = elapsed.count() / static_cast<double>(count);
+    return static_cast<double>(CountingAllocator<int>::allocations) / static_cast<double>(count);
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t count{argc > 1 ? std::stoul(argv[1]) : 1'000'000ul};
+
+    std::cout << "Vectors: " << count << ", SmallVector inline capacity: 8" << std::endl;
+    std::cout << std::setw(10) << "elements" << std::setw(18) << "Vector allocs" << std::setw(14) << "Vector ns"
+              << std::setw(22) << "SmallVector allocs" << std::setw(18) << "SmallVector ns" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    for (size_t elements : {1ul, 2ul, 4ul, 8ul, 9ul, 16ul, 64ul})
+    {
+        double vectorNs{}, smallNs{};
+        const double vectorAllocs{run<Vector<int, CountingAllocator<int>>>(count, elements, vectorNs)};
+        const double smallAllocs{run<SmallVector<int, 8ul, CountingAllocator<int>>>(count, elements, smallNs)};
+        std::cout << std::setw(10) << elements << std::setw(18) << vectorAllocs << std::setw(14) << vectorNs
+                  << std::setw(22) << smallAllocs << std::setw(18) << smallNs << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
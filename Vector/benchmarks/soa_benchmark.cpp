@@ -0,0 +1,86 @@
+// g++ -std=c++20 -O3 benchmarks/soa_benchmark.cpp -o soa_benchmark
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+
+#include "../soa_vector.hpp"
+#include "../soa_vector_impl.hpp"
+
+/// @brief Typical wide record: the hot loop reads only 'price' and 'quantity'
+struct Order
+{
+    uint64_t id;
+    uint64_t customer;
+    uint64_t timestamp;
+    double price;
+    double discount;
+    uint32_t quantity;
+    uint32_t status;
+    uint64_t flags;
+    uint64_t reserved;
+
+    bool operator==(Order const &) const = default;
+};
+
+using Orders = SoAVector<uint64_t, uint64_t, uint64_t, double, double, uint32_t, uint32_t, uint64_t, uint64_t>;
+
+constexpr size_t kPrice{3ul}, kQuantity{5ul};
+
+/**
+ * @brief Runs 'fn' 'repeats' times
+ * @return Millions of rows per second and the last result of 'fn' (so the loop isn't thrown away)
+ */
+template <typename Fn>
+std::pair<double, double> measure(size_t rows, size_t repeats, Fn const &fn)
+{
+    double result{};
+    const auto start{std::chrono::steady_clock::now()};
+    for (size_t i{}; i < repeats; i++)
+        result += fn();
+    const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+    return {static_cast<double>(rows * repeats) / elapsed.count() / 1e6, result};
+}
+
+int main()
+{
+    constexpr size_t kRows{1ul << 22}, kRepeats{20ul};
+
+    Vector<Order> aos;
+    Orders soa;
+    aos.reserve(kRows);
+    soa.reserve(kRows);
+    for (size_t i{}; i < kRows; i++)
+    {
+        const Order order{i, i % 1000ul, i * 7ul, static_cast<double>(i % 97ul), 0.0,
+                          static_cast<uint32_t>(i % 13ul), 0u, 0ul, 0ul};
+        aos.push_back(order);
+        soa.push_back(order.id, order.customer, order.timestamp, order.price, order.discount,
+                      order.quantity, order.status, order.flags, order.reserved);
+    }
+
+    // Revenue: sum of 'price * quantity' over all rows
+    const auto [aosSpeed, aosResult]{measure(kRows, kRepeats, [&]()
+                                             {
+        double sum{};
+        for (Order const &order : aos)
+            sum += order.price * order.quantity;
+        return sum; })};
+
+    const auto [soaSpeed, soaResult]{measure(kRows, kRepeats, [&]()
+                                             {
+        const auto prices{soa.column<kPrice>()};
+        const auto quantities{soa.column<kQuantity>()};
+        double sum{};
+        for (size_t i{}; i < prices.size(); i++)
+            sum += prices[i] * quantities[i];
+        return sum; })};
+
+    std::cout << std::fixed << std::setprecision(1)
+              << "Rows: " << kRows << ", record: " << sizeof(Order) << " bytes, hot fields: "
+              << sizeof(double) + sizeof(uint32_t) << " bytes\n"
+              << "AoS scan: " << std::setw(8) << aosSpeed << " M rows/s\n"
+              << "SoA scan: " << std::setw(8) << soaSpeed << " M rows/s (x" << soaSpeed / aosSpeed << ")\n"
+              << "Checksums " << (aosResult == soaResult ? "match" : "DIFFER") << std::endl;
+    return aosResult == soaResult ? 0 : 1;
+}
@@ -0,0 +1,78 @@
+#ifndef GROWTH_POLICY_HPP
+#define GROWTH_POLICY_HPP
+
+#include <algorithm>
+#include <cstddef>
+
+// Growth policies for the "Vector". Policy is a type with the static function
+//     template <typename T> static constexpr size_t next(size_t capacity, size_t required) noexcept;
+// that returns new capacity (in elements) for a vector of 'T' that is full at 'capacity' and needs at least
+// 'required' elements. "Vector" never grows to less than 'required', even if policy returns less.
+
+/**
+ * @brief Multiplies capacity by 'Numerator / Denominator'.
+ * Bigger factor means fewer reallocations, smaller factor means less unused memory
+ * @tparam Numerator numerator of the factor
+ * @tparam Denominator denominator of the factor
+ */
+template <size_t Numerator, size_t Denominator = 1ul>
+struct GeometricGrowth
+{
+    static_assert(Numerator > Denominator, "Factor has to be greater than 1");
+
+    template <typename T>
+    static constexpr size_t next(size_t capacity, size_t required) noexcept
+    {
+        return std::max(required, std::max(capacity * Numerator / Denominator, capacity + 1ul));
+    }
+};
+
+/// @brief Default policy: capacity is doubled
+using DoublingGrowth = GeometricGrowth<2ul>;
+
+/// @brief Capacity is multiplied by 1.5, so the memory freed by earlier reallocations can be reused
+using OneAndHalfGrowth = GeometricGrowth<3ul, 2ul>;
+
+/**
+ * @brief Adds 'Chunk' elements at a time. Wastes at most 'Chunk' elements, but appending
+ * 'n' elements one by one costs O(n^2 / Chunk) element moves
+ * @tparam Chunk count of elements added per reallocation
+ */
+template <size_t Chunk>
+struct FixedChunkGrowth
+{
+    static_assert(Chunk > 0ul, "Chunk has to be greater than zero");
+
+    template <typename T>
+    static constexpr size_t next(size_t capacity, size_t required) noexcept
+    {
+        return (std::max(required, capacity + 1ul) + Chunk - 1ul) / Chunk * Chunk;
+    }
+};
+
+/**
+ * @brief Doubles capacity while the storage is small, then grows by 'Numerator / Denominator' and rounds
+ * the storage size up to a whole number of pages. Large blocks are mapped by the system allocator in pages
+ * anyway, so rounding uses the tail of the last page instead of leaving it unused
+ * @tparam PageSize size of the page in bytes
+ * @tparam Threshold storage size in bytes from which the storage is page aligned
+ * @tparam Numerator numerator of the factor for large storage
+ * @tparam Denominator denominator of the factor for large storage
+ */
+template <size_t PageSize = 4096ul, size_t Threshold = 1ul << 20, size_t Numerator = 3ul, size_t Denominator = 2ul>
+struct PageAlignedGrowth
+{
+    static_assert(PageSize > 0ul && Numerator > Denominator);
+
+    template <typename T>
+    static constexpr size_t next(size_t capacity, size_t required) noexcept
+    {
+        if (capacity * sizeof(T) < Threshold)
+            return DoublingGrowth::next<T>(capacity, required);
+
+        const size_t bytes{std::max(required, capacity * Numerator / Denominator) * sizeof(T)};
+        return (bytes + PageSize - 1ul) / PageSize * PageSize / sizeof(T);
+    }
+};
+
+#endif // !GROWTH_POLICY_HPP
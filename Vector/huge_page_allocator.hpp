@@ -0,0 +1,78 @@
+#ifndef HUGE_PAGE_ALLOCATOR_HPP
+#define HUGE_PAGE_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <memory>
+
+/**
+ * @brief Allocator for very large vectors (Linux).
+ * Blocks of at least 'Threshold' bytes are mapped with "mmap()" at a huge page boundary and marked with
+ * "MADV_HUGEPAGE", so transparent huge pages cut TLB misses and page faults. Such blocks grow with "mremap()":
+ * pages are moved by the kernel instead of copying the data. Smaller blocks come from "std::allocator".
+ * @tparam T type of the elements
+ * @tparam Threshold minimal size of a block in bytes that is mapped with huge pages
+ */
+template <typename T, size_t Threshold = 1ul << 21>
+class HugePageAllocator
+{
+public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    /// @brief Size of a huge page, mapped blocks are aligned to it and rounded up to it
+    static constexpr size_t kHugePageSize{1ul << 21};
+
+    template <typename U>
+    struct rebind
+    {
+        using other = HugePageAllocator<U, Threshold>;
+    };
+
+    HugePageAllocator() noexcept = default;
+
+    template <typename U>
+    HugePageAllocator(HugePageAllocator<U, Threshold> const &) noexcept {}
+
+    /**
+     * @brief Allocates storage for 'n' elements
+     * @param n count of elements
+     * @return Pointer to the storage
+     * @throws "std::bad_alloc" if storage can't be allocated
+     */
+    T *allocate(size_t n);
+
+    /**
+     * @brief Frees storage allocated with "allocate()" or "reallocate()"
+     * @param p pointer to the storage
+     * @param n count of elements the storage was allocated for
+     */
+    void deallocate(T *p, size_t n) noexcept;
+
+    /**
+     * @brief Resizes mapped storage in place or moves its pages to another address.
+     * Contents are preserved bitwise, so it suits only trivially relocatable elements. If the kernel moves the pages
+     * to an address that isn't aligned to a huge page, they are copied to a newly allocated aligned block
+     * @param p pointer to the storage
+     * @param n count of elements the storage was allocated for
+     * @param count new count of elements
+     * @return Pointer to the resized storage or "nullptr" if storage can't be remapped (one of the sizes
+     * is below 'Threshold'), then 'p' stays valid and the caller has to allocate and copy by itself
+     * @throws "std::bad_alloc" if kernel refused to remap the storage
+     */
+    T *reallocate(T *p, size_t n, size_t count);
+
+    template <typename U>
+    bool operator==(HugePageAllocator<U, Threshold> const &) const noexcept { return true; }
+
+private:
+    /// @return "true" if block of 'n' elements is mapped
+    static constexpr bool isMapped(size_t n) noexcept { return n * sizeof(T) >= Threshold; }
+
+    /// @return Size of the mapping for 'n' elements in bytes
+    static constexpr size_t mappedBytes(size_t n) noexcept
+    {
+        return (n * sizeof(T) + kHugePageSize - 1ul) / kHugePageSize * kHugePageSize;
+    }
+};
+
+#endif // !HUGE_PAGE_ALLOCATOR_HPP
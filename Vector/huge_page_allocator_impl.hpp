@@ -0,0 +1,76 @@
+#ifndef HUGE_PAGE_ALLOCATOR_IMPL_HPP
+#define HUGE_PAGE_ALLOCATOR_IMPL_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <sys/mman.h>
+
+#include "huge_page_allocator.hpp"
+
+template <typename T, size_t Threshold>
+T *HugePageAllocator<T, Threshold>::allocate(size_t n)
+{
+    if (!isMapped(n))
+        return std::allocator<T>().allocate(n);
+
+    // Kernel aligns mappings only to the normal page, so one extra huge page is mapped and the
+    // unaligned head and tail are unmapped afterwards
+    const size_t bytes{mappedBytes(n)};
+    void *raw{mmap(nullptr, bytes + kHugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)};
+    if (raw == MAP_FAILED)
+        throw std::bad_alloc();
+
+    const uintptr_t begin{reinterpret_cast<uintptr_t>(raw)};
+    const uintptr_t aligned{(begin + kHugePageSize - 1ul) & ~(kHugePageSize - 1ul)};
+    if (aligned != begin)
+        munmap(raw, aligned - begin);
+    munmap(reinterpret_cast<void *>(aligned + bytes), kHugePageSize - (aligned - begin));
+
+    // Advice only: if THP are disabled, mapping works with normal pages
+    madvise(reinterpret_cast<void *>(aligned), bytes, MADV_HUGEPAGE);
+    return reinterpret_cast<T *>(aligned);
+}
+
+template <typename T, size_t Threshold>
+void HugePageAllocator<T, Threshold>::deallocate(T *p, size_t n) noexcept
+{
+    if (isMapped(n))
+        munmap(p, mappedBytes(n));
+    else
+        std::allocator<T>().deallocate(p, n);
+}
+
+template <typename T, size_t Threshold>
+T *HugePageAllocator<T, Threshold>::reallocate(T *p, size_t n, size_t count)
+{
+    if (!isMapped(n) || !isMapped(count))
+        return nullptr;
+
+    void *data{mremap(p, mappedBytes(n), mappedBytes(count), MREMAP_MAYMOVE)};
+    if (data == MAP_FAILED)
+        throw std::bad_alloc();
+    if (reinterpret_cast<uintptr_t>(data) % kHugePageSize == 0ul)
+    {
+        madvise(data, mappedBytes(count), MADV_HUGEPAGE);
+        return static_cast<T *>(data);
+    }
+
+    // Kernel moved the pages off the huge page boundary, where they can't be backed by huge pages.
+    // Data is copied to an aligned block; if there's no memory for it, the unaligned block is still usable
+    T *aligned;
+    try
+    {
+        aligned = allocate(count);
+    }
+    catch (std::bad_alloc const &)
+    {
+        return static_cast<T *>(data);
+    }
+    std::memcpy(static_cast<void *>(aligned), data, std::min(n, count) * sizeof(T));
+    munmap(data, mappedBytes(count));
+    return aligned;
+}
+
+#endif // !HUGE_PAGE_ALLOCATOR_IMPL_HPP
@@ -0,0 +1,193 @@
+#ifndef PERSISTENT_VECTOR_HPP
+#define PERSISTENT_VECTOR_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <string>
+#include <type_traits>
+
+/**
+ * @brief File-backed variant of the "Vector" for trivially copyable elements (Linux).
+ * Elements live in a file that is mapped into memory with "mmap()", so an existing table is opened
+ * without reading or rebuilding it, and every process that maps the file shares the same page cache.
+ * File starts with a small header (magic, version, element size, size, capacity) that is checked on open.
+ * Changes get to the file through the page cache; call "sync()" to make sure they reached the disk.
+ * Read-only vector sees elements appended by a writer only up to the capacity the file had when it was opened.
+ * @tparam T type of the elements
+ */
+template <typename T>
+class PersistentVector
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be stored in a file as is");
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = T const &;
+    using pointer = T *;
+    using const_pointer = T const *;
+    using iterator = T *;
+    using const_iterator = T const *;
+
+    /// @brief How the file is opened
+    enum class Mode
+    {
+        ReadOnly, // File has to exist, mapping is shared and read-only, modifying methods throw
+        ReadWrite // File is created if it doesn't exist
+    };
+
+    /// @brief Version of the file format, file with another version isn't opened
+    static constexpr uint32_t kVersion{1u};
+
+    /**
+     * @brief Opens (and maps) the file
+     * @param path path to the file
+     * @param mode how to open the file
+     * @throws "std::system_error" if file can't be opened or mapped,
+     * "std::runtime_error" if file isn't a vector of 'T' (wrong magic, version or element size)
+     */
+    explicit PersistentVector(std::string const &path, Mode mode = Mode::ReadWrite);
+
+    /// @brief Mapping can't be shared between objects
+    PersistentVector(PersistentVector const &) = delete;
+    PersistentVector &operator=(PersistentVector const &) = delete;
+
+    /// @brief Move ctor. Moved-from vector has no file and is empty
+    PersistentVector(PersistentVector &&vec) noexcept;
+
+    /// @brief Move-assignment operator
+    PersistentVector &operator=(PersistentVector &&vec) noexcept;
+
+    /// @brief Dtor. Unmaps and closes the file, doesn't wait for the disk (see "sync()")
+    virtual ~PersistentVector();
+
+    /**
+     * @brief Adding new element to the vector
+     * @param value value to add
+     */
+    void push_back(T const &value);
+
+    /**
+     * @brief Appends elements from [first, last) with a single copy of the contiguous range
+     * @param first beginning of the range
+     * @param last end of the range
+     */
+    template <std::contiguous_iterator It>
+    void append(It first, It last);
+
+    /**
+     * @brief Checker for emptiness of the vector
+     * @return "true" if vector is empty, otherwise "false"
+     */
+    [[nodiscard]] bool empty() const noexcept;
+
+    /// @return Size of the vector, at most "capacity()"
+    size_t size() const noexcept;
+
+    /// @return Capacity of the vector - how many elements the mapped part of the file can hold
+    size_t capacity() const noexcept;
+
+    /**
+     * @brief Grows the file to hold at least 'capacity' elements
+     * @param capacity new value of the capacity
+     */
+    void reserve(size_t capacity);
+
+    /**
+     * @brief Resizes the container to contain 'new_size' elements, new elements are zero-filled
+     * @param new_size The new size of the container
+     */
+    void resize(size_t new_size);
+
+    /// @brief Erases all elements from the vector. Capacity stays the same
+    void clear();
+
+    /**
+     * @brief Access the element at the specified index with bounds checking
+     * @param index The index of the element to access
+     * @return A reference to the element at the specified index
+     * @throws "std::out_of_range" if the index is out of bounds
+     */
+    T &at(size_t index);
+    T const &at(size_t index) const;
+
+    /**
+     * @brief Access the element at the specified index without bounds checking.
+     * Writing through the reference to a read-only vector causes "SIGSEGV"
+     * @param index The index of the element to access
+     * @return A reference to the element at the specified index
+     */
+    T &operator[](size_t index);
+    T const &operator[](size_t index) const;
+
+    /**
+     * @brief Accesses the first|last element in the vector
+     * @throws "std::out_of_range" if the vector is empty
+     */
+    T &front();
+    T const &front() const;
+    T &back();
+    T const &back() const;
+
+    /// @return Pointer to the first element in the mapping
+    T *data() noexcept;
+    T const *data() const noexcept;
+
+    /// @return Iterators to the first element and past the last one
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+
+    /// @return View of all elements
+    operator std::span<T>() noexcept;
+    operator std::span<T const>() const noexcept;
+
+    /// @brief Blocks until all changes (elements and header) are written to the disk
+    void sync();
+
+    /// @brief Schedules writing of changes to the disk and returns immediately
+    void flush();
+
+private:
+    /// @brief Header at the beginning of the file
+    struct Header
+    {
+        char magic[8];         // "PVECTOR" with terminating zero
+        uint32_t version;      // "kVersion"
+        uint32_t elementSize;  // "sizeof(T)"
+        uint64_t size;         // Count of elements
+        uint64_t capacity;     // Count of elements the file can hold
+        uint64_t reserved[4];  // For future use, zeroed
+    };
+
+    /// @brief Elements start after the header at the offset aligned for 'T' and for cache line
+    static constexpr size_t kDataOffset{(std::max(sizeof(Header), alignof(T)) + 63ul) / 64ul * 64ul};
+
+    static constexpr char kMagic[8]{"PVECTOR"};
+
+    int m_fd;           // File descriptor
+    bool m_readOnly;    // Mode the file was opened in
+    void *m_mapping;    // Whole file mapping, header included
+    size_t m_mapped;    // Size of the mapping in bytes
+    Header *m_header;   // Header inside the mapping
+    T *m_data;          // Elements inside the mapping
+
+    /// @brief Unmaps and closes the file of specified object
+    void clearObj(PersistentVector &obj) noexcept;
+
+    /// @brief Moves passed object content to current object
+    void moveObj(PersistentVector &&rhs) noexcept;
+
+    /// @brief Grows the file and the mapping to hold 'capacity' elements
+    void remap(size_t capacity);
+
+    /// @throws "std::logic_error" if the vector is read-only
+    void checkWritable() const;
+};
+
+#endif // !PERSISTENT_VECTOR_HPP
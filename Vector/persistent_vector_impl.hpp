@@ -0,0 +1,299 @@
+#ifndef PERSISTENT_VECTOR_IMPL_HPP
+#define PERSISTENT_VECTOR_IMPL_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+
+#include "persistent_vector.hpp"
+
+template <typename T>
+PersistentVector<T>::PersistentVector(std::string const &path, Mode mode)
+    : m_fd(-1), m_readOnly(mode == Mode::ReadOnly), m_mapping(nullptr), m_mapped(0ul), m_header(nullptr), m_data(nullptr)
+{
+    m_fd = m_readOnly ? open(path.c_str(), O_RDONLY | O_CLOEXEC) : open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (m_fd < 0)
+        throw std::system_error(errno, std::generic_category(), "Can't open \"" + path + '"');
+
+    try
+    {
+        struct stat st{};
+        if (fstat(m_fd, &st) != 0)
+            throw std::system_error(errno, std::generic_category(), "Can't get size of \"" + path + '"');
+        size_t fileSize{static_cast<size_t>(st.st_size)};
+
+        // New file: header only, no capacity yet
+        if (!fileSize && !m_readOnly)
+        {
+            Header header{};
+            std::memcpy(header.magic, kMagic, sizeof(kMagic));
+            header.version = kVersion;
+            header.elementSize = sizeof(T);
+            if (ftruncate(m_fd, static_cast<off_t>(kDataOffset)) != 0 || pwrite(m_fd, &header, sizeof(header), 0) != sizeof(header))
+                throw std::system_error(errno, std::generic_category(), "Can't initialize \"" + path + '"');
+            fileSize = kDataOffset;
+        }
+
+        Header header{};
+        if (fileSize < kDataOffset || pread(m_fd, &header, sizeof(header), 0) != sizeof(header) ||
+            std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0)
+            throw std::runtime_error('"' + path + "\" isn't a persistent vector");
+        if (header.version != kVersion || header.elementSize != sizeof(T))
+            throw std::runtime_error('"' + path + "\" has another version or element type");
+        if (header.size > header.capacity || fileSize < kDataOffset + header.capacity * sizeof(T))
+            throw std::runtime_error('"' + path + "\" is truncated");
+
+        m_mapped = kDataOffset + header.capacity * sizeof(T);
+        m_mapping = mmap(nullptr, m_mapped, m_readOnly ? PROT_READ : PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+        if (m_mapping == MAP_FAILED)
+        {
+            m_mapping = nullptr;
+            throw std::system_error(errno, std::generic_category(), "Can't map \"" + path + '"');
+        }
+        m_header = static_cast<Header *>(m_mapping);
+        m_data = reinterpret_cast<T *>(static_cast<char *>(m_mapping) + kDataOffset);
+    }
+    catch (...)
+    {
+        clearObj(*this);
+        throw;
+    }
+}
+
+template <typename T>
+PersistentVector<T>::PersistentVector(PersistentVector &&vec) noexcept { moveObj(std::move(vec)); }
+
+template <typename T>
+PersistentVector<T> &PersistentVector<T>::operator=(PersistentVector &&vec) noexcept
+{
+    if (this == &vec)
+        return *this;
+    clearObj(*this);
+    moveObj(std::move(vec));
+    return *this;
+}
+
+template <typename T>
+PersistentVector<T>::~PersistentVector() { clearObj(*this); }
+
+template <typename T>
+void PersistentVector<T>::clearObj(PersistentVector &obj) noexcept
+{
+    if (obj.m_mapping)
+        munmap(obj.m_mapping, obj.m_mapped);
+    if (obj.m_fd >= 0)
+        close(obj.m_fd);
+    obj.m_fd = -1;
+    obj.m_mapping = nullptr;
+    obj.m_mapped = 0ul;
+    obj.m_header = nullptr;
+    obj.m_data = nullptr;
+}
+
+template <typename T>
+void PersistentVector<T>::moveObj(PersistentVector &&rhs) noexcept
+{
+    m_fd = std::exchange(rhs.m_fd, -1);
+    m_readOnly = rhs.m_readOnly;
+    m_mapping = std::exchange(rhs.m_mapping, nullptr);
+    m_mapped = std::exchange(rhs.m_mapped, 0ul);
+    m_header = std::exchange(rhs.m_header, nullptr);
+    m_data = std::exchange(rhs.m_data, nullptr);
+}
+
+template <typename T>
+void PersistentVector<T>::checkWritable() const
+{
+    if (m_readOnly)
+        throw std::logic_error("Persistent vector is opened read-only");
+}
+
+template <typename T>
+void PersistentVector<T>::remap(size_t capacity)
+{
+    const size_t bytes{kDataOffset + capacity * sizeof(T)};
+    if (ftruncate(m_fd, static_cast<off_t>(bytes)) != 0)
+        throw std::system_error(errno, std::generic_category(), "Can't grow the file of persistent vector");
+
+    void *mapping{mremap(m_mapping, m_mapped, bytes, MREMAP_MAYMOVE)};
+    if (mapping == MAP_FAILED)
+        throw std::system_error(errno, std::generic_category(), "Can't remap the file of persistent vector");
+
+    m_mapping = mapping;
+    m_mapped = bytes;
+    m_header = static_cast<Header *>(m_mapping);
+    m_data = reinterpret_cast<T *>(static_cast<char *>(m_mapping) + kDataOffset);
+    m_header->capacity = capacity;
+}
+
+template <typename T>
+void PersistentVector<T>::push_back(T const &value)
+{
+    checkWritable();
+    if (m_header->size == m_header->capacity)
+    {
+        // 'value' may refer to an element, and the mapping may move
+        T const copy(value);
+        reserve(std::max<size_t>(m_header->capacity * 2ul, 1ul));
+        m_data[m_header->size++] = copy;
+        return;
+    }
+    m_data[m_header->size++] = value;
+}
+
+template <typename T>
+template <std::contiguous_iterator It>
+void PersistentVector<T>::append(It first, It last)
+{
+    static_assert(std::is_same_v<std::iter_value_t<It>, T>);
+    checkWritable();
+
+    const size_t count{static_cast<size_t>(last - first)};
+    if (m_header->size + count > m_header->capacity)
+        reserve(std::max<size_t>(m_header->size + count, m_header->capacity * 2ul));
+    if (count)
+        std::memcpy(m_data + m_header->size, std::to_address(first), count * sizeof(T));
+    m_header->size += count;
+}
+
+template <typename T>
+bool PersistentVector<T>::empty() const noexcept { return !size(); }
+
+template <typename T>
+size_t PersistentVector<T>::size() const noexcept
+{
+    // Moved-from vector has no mapping, so there is no header to read. Writer in another process may have grown
+    // the file after it was mapped here, elements past the mapping aren't visible
+    return m_header ? std::min<size_t>(m_header->size, capacity()) : 0ul;
+}
+
+template <typename T>
+size_t PersistentVector<T>::capacity() const noexcept { return m_mapping ? (m_mapped - kDataOffset) / sizeof(T) : 0ul; }
+
+template <typename T>
+void PersistentVector<T>::reserve(size_t capacity)
+{
+    checkWritable();
+    if (capacity > m_header->capacity)
+        remap(capacity);
+}
+
+template <typename T>
+void PersistentVector<T>::resize(size_t new_size)
+{
+    checkWritable();
+    if (new_size > m_header->capacity)
+        reserve(std::max<size_t>(new_size, m_header->capacity * 2ul));
+    // Tail of the file may hold old elements, new ones have to be zeroed
+    if (new_size > m_header->size)
+        std::memset(static_cast<void *>(m_data + m_header->size), 0, (new_size - m_header->size) * sizeof(T));
+    m_header->size = new_size;
+}
+
+template <typename T>
+void PersistentVector<T>::clear()
+{
+    checkWritable();
+    m_header->size = 0ul;
+}
+
+template <typename T>
+T &PersistentVector<T>::at(size_t index)
+{
+    if (index >= size())
+        throw std::out_of_range("Index out of bounds");
+    return m_data[index];
+}
+
+template <typename T>
+T const &PersistentVector<T>::at(size_t index) const
+{
+    if (index >= size())
+        throw std::out_of_range("Index out of bounds");
+    return m_data[index];
+}
+
+template <typename T>
+T &PersistentVector<T>::operator[](size_t index) { return m_data[index]; }
+
+template <typename T>
+T const &PersistentVector<T>::operator[](size_t index) const { return m_data[index]; }
+
+template <typename T>
+T &PersistentVector<T>::front()
+{
+    if (empty())
+        throw std::out_of_range("Vector is empty. Cannot access front element.");
+    return m_data[0];
+}
+
+template <typename T>
+T const &PersistentVector<T>::front() const
+{
+    if (empty())
+        throw std::out_of_range("Vector is empty. Cannot access front element.");
+    return m_data[0];
+}
+
+template <typename T>
+T &PersistentVector<T>::back()
+{
+    if (empty())
+        throw std::out_of_range("back(): vector is empty");
+    return m_data[size() - 1ul];
+}
+
+template <typename T>
+T const &PersistentVector<T>::back() const
+{
+    if (empty())
+        throw std::out_of_range("back() const: vector is empty");
+    return m_data[size() - 1ul];
+}
+
+template <typename T>
+T *PersistentVector<T>::data() noexcept { return m_data; }
+
+template <typename T>
+T const *PersistentVector<T>::data() const noexcept { return m_data; }
+
+template <typename T>
+typename PersistentVector<T>::iterator PersistentVector<T>::begin() noexcept { return m_data; }
+
+template <typename T>
+typename PersistentVector<T>::const_iterator PersistentVector<T>::begin() const noexcept { return m_data; }
+
+template <typename T>
+typename PersistentVector<T>::iterator PersistentVector<T>::end() noexcept { return m_data + size(); }
+
+template <typename T>
+typename PersistentVector<T>::const_iterator PersistentVector<T>::end() const noexcept { return m_data + size(); }
+
+template <typename T>
+PersistentVector<T>::operator std::span<T>() noexcept { return {m_data, size()}; }
+
+template <typename T>
+PersistentVector<T>::operator std::span<T const>() const noexcept { return {m_data, size()}; }
+
+template <typename T>
+void PersistentVector<T>::sync()
+{
+    if (!m_readOnly && msync(m_mapping, m_mapped, MS_SYNC) != 0)
+        throw std::system_error(errno, std::generic_category(), "Can't sync persistent vector");
+}
+
+template <typename T>
+void PersistentVector<T>::flush()
+{
+    if (!m_readOnly && msync(m_mapping, m_mapped, MS_ASYNC) != 0)
+        throw std::system_error(errno, std::generic_category(), "Can't flush persistent vector");
+}
+
+#endif // !PERSISTENT_VECTOR_IMPL_HPP
@@ -0,0 +1,85 @@
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include <cstddef>
+#include <memory>
+
+#include "vector_base.hpp"
+
+/**
+ * @brief Variant of the "Vector" that keeps up to 'N' elements inside the object itself.
+ * Heap storage is allocated only when the size exceeds 'N', so small vectors cost no allocation at all.
+ * Public API is the same as the "Vector" one, storage grows twice at a time.
+ * @tparam T type of the elements
+ * @tparam N count of the elements stored inline
+ * @tparam Allocator allocator of the heap storage
+ */
+template <typename T, size_t N, class Allocator = std::allocator<T>>
+class SmallVector : public VectorBase<SmallVector<T, N, Allocator>, T, Allocator, DoublingGrowth>
+{
+    static_assert(N > 0ul, "Inline capacity has to be greater than zero");
+
+    using Base = VectorBase<SmallVector, T, Allocator, DoublingGrowth>;
+    friend Base;
+
+public:
+    /// @brief Default ctor
+    explicit SmallVector();
+
+    /// @brief Ctors (copy|move) with template arg
+    explicit SmallVector(T const &data);
+    explicit SmallVector(T &&data);
+
+    /// @brief Copy ctor
+    explicit SmallVector(SmallVector const &vec);
+
+    /// @brief Move ctor. Inline elements are moved one by one, heap storage is stolen
+    explicit SmallVector(SmallVector &&vec) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /// @brief Copy-assignment operator
+    SmallVector &operator=(SmallVector const &vec);
+
+    /// @brief Move-assignment operator
+    SmallVector &operator=(SmallVector &&vec) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /// @brief Dtor
+    virtual ~SmallVector();
+
+    /// @return "true" if elements are stored inline, otherwise "false"
+    bool is_inline() const noexcept;
+
+private:
+    using typename Base::AllocTraits;
+    using Base::m_data;
+    using Base::m_size;
+    using Base::m_capacity;
+    using Base::m_alloc;
+
+    alignas(T) std::byte m_inline[N * sizeof(T)]; // Inline storage for the first 'N' elements, 'm_data' points here while inline
+
+    /// @return Pointer to the inline storage
+    T *inlineData() noexcept;
+
+    /**
+     * @brief Copies passed object content to current object
+     * @param rhs object to copy
+     */
+    void copyObj(SmallVector const &rhs);
+
+    /**
+     * @brief Moves passed object content to current object
+     * @param rhs object to move
+     */
+    void moveObj(SmallVector &&rhs) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /**
+     * @brief Erases all data from object, frees its heap storage and makes it inline again
+     * @param obj object to erase all data within
+     */
+    void clearObj(SmallVector &obj);
+
+    /// @return "true" if 'm_data' is the heap storage obtained from 'm_alloc'
+    bool ownsStorage() const noexcept;
+};
+
+#endif // !SMALL_VECTOR_HPP
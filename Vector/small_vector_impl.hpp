@@ -0,0 +1,133 @@
+#ifndef SMALL_VECTOR_IMPL_HPP
+#define SMALL_VECTOR_IMPL_HPP
+
+#include <cstring>
+#include <utility>
+
+#include "small_vector.hpp"
+#include "vector_base_impl.hpp"
+
+template <typename T, size_t N, class Allocator>
+T *SmallVector<T, N, Allocator>::inlineData() noexcept { return reinterpret_cast<T *>(m_inline); }
+
+template <typename T, size_t N, class Allocator>
+void SmallVector<T, N, Allocator>::copyObj(SmallVector const &rhs)
+{
+    if (rhs.m_size > N)
+    {
+        m_data = AllocTraits::allocate(m_alloc, rhs.m_size);
+        m_capacity = rhs.m_size;
+    }
+
+    try
+    {
+        std::uninitialized_copy_n(rhs.m_data, rhs.m_size, m_data);
+    }
+    catch (...)
+    {
+        clearObj(*this);
+        throw;
+    }
+    m_size = rhs.m_size;
+}
+
+template <typename T, size_t N, class Allocator>
+void SmallVector<T, N, Allocator>::moveObj(SmallVector &&rhs) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+    if (!rhs.is_inline())
+    {
+        m_data = std::exchange(rhs.m_data, rhs.inlineData());
+        m_capacity = std::exchange(rhs.m_capacity, N);
+        m_size = std::exchange(rhs.m_size, 0ul);
+        return;
+    }
+
+    // Inline elements can't be stolen, they live inside 'rhs'
+    if constexpr (is_trivially_relocatable_v<T>)
+    {
+        if (rhs.m_size)
+            std::memcpy(static_cast<void *>(m_data), static_cast<void const *>(rhs.m_data), rhs.m_size * sizeof(T));
+    }
+    else
+    {
+        std::uninitialized_move_n(rhs.m_data, rhs.m_size, m_data);
+        std::destroy_n(rhs.m_data, rhs.m_size);
+    }
+    m_size = std::exchange(rhs.m_size, 0ul);
+}
+
+template <typename T, size_t N, class Allocator>
+void SmallVector<T, N, Allocator>::clearObj(SmallVector &obj)
+{
+    std::destroy_n(obj.m_data, obj.m_size);
+    if (!obj.is_inline())
+        AllocTraits::deallocate(obj.m_alloc, obj.m_data, obj.m_capacity);
+    obj.m_data = obj.inlineData();
+    obj.m_size = 0ul;
+    obj.m_capacity = N;
+}
+
+template <typename T, size_t N, class Allocator>
+bool SmallVector<T, N, Allocator>::ownsStorage() const noexcept { return !is_inline(); }
+
+template <typename T, size_t N, class Allocator>
+SmallVector<T, N, Allocator>::SmallVector() : Base()
+{
+    m_data = inlineData();
+    m_capacity = N;
+}
+
+template <typename T, size_t N, class Allocator>
+SmallVector<T, N, Allocator>::SmallVector(T const &data) : SmallVector() { this->emplace_back(data); }
+
+template <typename T, size_t N, class Allocator>
+SmallVector<T, N, Allocator>::SmallVector(T &&data) : SmallVector() { this->emplace_back(std::move(data)); }
+
+template <typename T, size_t N, class Allocator>
+SmallVector<T, N, Allocator>::SmallVector(SmallVector const &vec)
+    : Base(AllocTraits::select_on_container_copy_construction(vec.m_alloc))
+{
+    m_data = inlineData();
+    m_capacity = N;
+    copyObj(vec);
+}
+
+template <typename T, size_t N, class Allocator>
+SmallVector<T, N, Allocator>::SmallVector(SmallVector &&vec) noexcept(std::is_nothrow_move_constructible_v<T>)
+    : Base(std::move(vec.m_alloc))
+{
+    m_data = inlineData();
+    m_capacity = N;
+    moveObj(std::move(vec));
+}
+
+template <typename T, size_t N, class Allocator>
+SmallVector<T, N, Allocator>::~SmallVector() { clearObj(*this); }
+
+template <typename T, size_t N, class Allocator>
+SmallVector<T, N, Allocator> &SmallVector<T, N, Allocator>::operator=(SmallVector const &vec)
+{
+    if (this == &vec)
+        return *this;
+    clearObj(*this);
+    copyObj(vec);
+    return *this;
+}
+
+template <typename T, size_t N, class Allocator>
+SmallVector<T, N, Allocator> &SmallVector<T, N, Allocator>::operator=(SmallVector &&vec) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+    if (this == &vec)
+        return *this;
+    clearObj(*this);
+    moveObj(std::move(vec));
+    return *this;
+}
+
+template <typename T, size_t N, class Allocator>
+bool SmallVector<T, N, Allocator>::is_inline() const noexcept
+{
+    return m_data == reinterpret_cast<T const *>(m_inline);
+}
+
+#endif // !SMALL_VECTOR_IMPL_HPP
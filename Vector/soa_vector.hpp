@@ -0,0 +1,124 @@
+#ifndef SOA_VECTOR_HPP
+#define SOA_VECTOR_HPP
+
+#include <span>
+#include <tuple>
+
+#include "vector.hpp"
+
+/**
+ * @brief Structure-of-arrays container: record of 'Fields' is stored field by field,
+ * each field in its own contiguous "Vector" column. A loop that touches only some fields
+ * reads only their columns, so whole cache lines are useful data and loops vectorize.
+ * Rows are accessed through tuples of references, columns - through "std::span".
+ * @tparam Fields types of the fields of a record
+ */
+template <typename... Fields>
+class SoAVector
+{
+    static_assert(sizeof...(Fields) > 0ul, "Record has to have at least one field");
+
+public:
+    /// @brief Copy of a row
+    using value_type = std::tuple<Fields...>;
+    /// @brief Row proxy: references to the fields of a row in their columns
+    using reference = std::tuple<Fields &...>;
+    using const_reference = std::tuple<Fields const &...>;
+
+    /// @brief Type of the field with specified index
+    template <size_t I>
+    using field_type = std::tuple_element_t<I, value_type>;
+
+    /// @brief Default ctor
+    explicit SoAVector() = default;
+
+    /**
+     * @brief Adding new row to the vector
+     * @param fields values of the fields
+     */
+    void push_back(Fields const &...fields);
+
+    /**
+     * @brief Adding new row to the vector. Move version
+     * @param fields values of the fields
+     */
+    void push_back(Fields &&...fields);
+
+    /**
+     * @brief Adding new row to the vector
+     * @param row values of the fields
+     */
+    void push_back(value_type const &row);
+
+    /**
+     * @brief Checker for emptiness of the vector
+     * @return "true" if vector is empty, otherwise "false"
+     */
+    [[nodiscard]] bool empty() const noexcept;
+
+    /// @return Count of rows
+    size_t size() const noexcept;
+
+    /**
+     * @brief Reserves storage for 'capacity' rows in every column
+     * @param capacity new value of the capacity
+     */
+    void reserve(size_t capacity);
+
+    /**
+     * @brief Resizes every column to 'new_size' rows, new fields are value-initialized.
+     * If a field throws, all columns keep their old size
+     * @param new_size new count of rows
+     */
+    void resize(size_t new_size);
+
+    /// @brief Erases all rows
+    void clear() noexcept;
+
+    /**
+     * @brief Access the row at the specified index without bounds checking
+     * @param index index of the row
+     * @return Tuple of references to the fields of the row
+     */
+    reference operator[](size_t index);
+    const_reference operator[](size_t index) const;
+
+    /**
+     * @brief Access the row at the specified index with bounds checking
+     * @param index index of the row
+     * @return Tuple of references to the fields of the row
+     * @throws "std::out_of_range" if the index is out of bounds
+     */
+    reference at(size_t index);
+    const_reference at(size_t index) const;
+
+    /**
+     * @brief Direct access to a column
+     * @tparam I index of the field
+     * @return View of the whole column
+     */
+    template <size_t I>
+    std::span<field_type<I>> column() noexcept;
+
+    template <size_t I>
+    std::span<field_type<I> const> column() const noexcept;
+
+private:
+    std::tuple<Vector<Fields>...> m_columns; // One column per field, all of the same size
+
+    /**
+     * @brief Calls 'fn' for each column
+     * @param fn function that takes a column
+     */
+    template <typename Fn>
+    void forEachColumn(Fn &&fn);
+
+    /**
+     * @brief Appends 'fields' to their columns. If any of them throws, the row isn't added
+     * @param fields values of the fields
+     */
+    template <typename... Args>
+    void appendRow(Args &&...fields);
+};
+
+#endif // !SOA_VECTOR_HPP
@@ -0,0 +1,142 @@
+#ifndef SOA_VECTOR_IMPL_HPP
+#define SOA_VECTOR_IMPL_HPP
+
+#include <stdexcept>
+#include <utility>
+
+#include "soa_vector.hpp"
+#include "vector_impl.hpp"
+
+template <typename... Fields>
+template <typename Fn>
+void SoAVector<Fields...>::forEachColumn(Fn &&fn)
+{
+    std::apply([&fn](auto &...columns)
+               { (fn(columns), ...); },
+               m_columns);
+}
+
+template <typename... Fields>
+template <typename... Args>
+void SoAVector<Fields...>::appendRow(Args &&...fields)
+{
+    size_t appended{};
+    try
+    {
+        // Comma fold goes column by column, so 'appended' is the count of columns that already got the new field
+        std::apply([&](auto &...columns)
+                   { ((columns.emplace_back(std::forward<Args>(fields)), ++appended), ...); },
+                   m_columns);
+    }
+    catch (...)
+    {
+        // Exactly those columns are cut back, so all of them stay of the same size.
+        // The column that threw has nothing to destroy, its size didn't change
+        size_t index{};
+        forEachColumn([&index, appended](auto &column)
+                      { if (index++ < appended) column.pop_back(); });
+        throw;
+    }
+}
+
+template <typename... Fields>
+void SoAVector<Fields...>::push_back(Fields const &...fields) { appendRow(fields...); }
+
+template <typename... Fields>
+void SoAVector<Fields...>::push_back(Fields &&...fields) { appendRow(std::move(fields)...); }
+
+template <typename... Fields>
+void SoAVector<Fields...>::push_back(value_type const &row)
+{
+    std::apply([this](Fields const &...fields)
+               { push_back(fields...); },
+               row);
+}
+
+template <typename... Fields>
+bool SoAVector<Fields...>::empty() const noexcept { return std::get<0>(m_columns).empty(); }
+
+template <typename... Fields>
+size_t SoAVector<Fields...>::size() const noexcept { return std::get<0>(m_columns).size(); }
+
+template <typename... Fields>
+void SoAVector<Fields...>::reserve(size_t capacity)
+{
+    forEachColumn([capacity](auto &column)
+                  { column.reserve(capacity); });
+}
+
+template <typename... Fields>
+void SoAVector<Fields...>::resize(size_t new_size)
+{
+    const size_t oldSize{size()};
+    size_t resized{};
+    try
+    {
+        forEachColumn([new_size, &resized](auto &column)
+                      { column.resize(new_size); ++resized; });
+    }
+    catch (...)
+    {
+        // Columns that already grew are cut back, shrinking doesn't throw. The column that threw kept its size
+        size_t index{};
+        forEachColumn([&index, resized, oldSize](auto &column)
+                      { if (index++ < resized) column.resize(oldSize); });
+        throw;
+    }
+}
+
+template <typename... Fields>
+void SoAVector<Fields...>::clear() noexcept
+{
+    forEachColumn([](auto &column)
+                  { column.clear(); });
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::reference SoAVector<Fields...>::operator[](size_t index)
+{
+    return std::apply([index](auto &...columns)
+                      { return reference(columns[index]...); },
+                      m_columns);
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::const_reference SoAVector<Fields...>::operator[](size_t index) const
+{
+    return std::apply([index](auto const &...columns)
+                      { return const_reference(columns[index]...); },
+                      m_columns);
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::reference SoAVector<Fields...>::at(size_t index)
+{
+    if (index >= size())
+        throw std::out_of_range("Index out of bounds");
+    return (*this)[index];
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::const_reference SoAVector<Fields...>::at(size_t index) const
+{
+    if (index >= size())
+        throw std::out_of_range("Index out of bounds");
+    return (*this)[index];
+}
+
+template <typename... Fields>
+template <size_t I>
+std::span<typename SoAVector<Fields...>::template field_type<I>> SoAVector<Fields...>::column() noexcept
+{
+    return std::get<I>(m_columns);
+}
+
+template <typename... Fields>
+template <size_t I>
+std::span<typename SoAVector<Fields...>::template field_type<I> const> SoAVector<Fields...>::column() const noexcept
+{
+    return std::get<I>(m_columns);
+}
+
+#endif // !SOA_VECTOR_IMPL_HPP
@@ -0,0 +1,98 @@
+#ifndef VECTOR_ALGORITHMS_HPP
+#define VECTOR_ALGORITHMS_HPP
+
+#include <functional>
+#include <type_traits>
+
+#include "vector.hpp"
+
+/**
+ * @brief Bulk operations over the whole "Vector" of arithmetic elements.
+ * Each operation works on raw contiguous storage, not through "operator[]", with loops written so the
+ * compiler can vectorize them. On x86 the AVX2 build of the loop is selected at runtime if the CPU supports it,
+ * otherwise the default (SSE2 on x86-64, scalar elsewhere) one is used.
+ * Large vectors are split into chunks that are processed by a thread pool, see "Execution".
+ * Scalar arguments take the element type of the vector, so "fill(doubles, 0)" converts 0 to "double".
+ */
+namespace bulk
+{
+    /// @brief Concept for the element types that have vectorized kernels
+    template <typename T>
+    concept Arithmetic = std::is_arithmetic_v<T>;
+
+    /// @brief How operation is executed
+    enum class Execution
+    {
+        Sequential, // Current thread only
+        Parallel,   // Chunks are spread across the thread pool
+        Auto        // Parallel for vectors of at least "kParallelThreshold" elements, otherwise sequential
+    };
+
+    /// @brief Minimal count of elements for which "Execution::Auto" goes parallel
+    inline constexpr size_t kParallelThreshold{1ul << 18};
+
+    /**
+     * @brief Assigns 'value' to every element
+     * @param vec vector to fill
+     * @param value value to assign
+     * @param execution execution mode
+     */
+    template <Arithmetic T, class... Rest>
+    void fill(Vector<T, Rest...> &vec, std::type_identity_t<T> value, Execution execution = Execution::Auto);
+
+    /**
+     * @brief Copies all elements of 'src' to 'dst'. 'dst' is resized to the size of 'src'
+     * @param src source vector
+     * @param dst destination vector
+     * @param execution execution mode
+     */
+    template <Arithmetic T, class... RestSrc, class... RestDst>
+    void copy(Vector<T, RestSrc...> const &src, Vector<T, RestDst...> &dst, Execution execution = Execution::Auto);
+
+    /**
+     * @brief Stores 'op(src[i])' to 'dst[i]'. 'dst' is resized to the size of 'src'
+     * @param src source vector
+     * @param dst destination vector, may be the same as 'src'
+     * @param op unary operation, has to be free of side effects
+     * @param execution execution mode
+     */
+    template <Arithmetic T, Arithmetic U, class... RestSrc, class... RestDst, typename UnaryOp>
+    void transform(Vector<T, RestSrc...> const &src, Vector<U, RestDst...> &dst, UnaryOp op,
+                   Execution execution = Execution::Auto);
+
+    /**
+     * @brief Folds all elements with 'op' starting from 'init'.
+     * Elements are combined in unspecified order, so 'op' has to be associative and commutative
+     * (for floating point types the result may differ from the plain loop in the last bits)
+     * @param vec vector to reduce
+     * @param init initial value
+     * @param op binary operation
+     * @param execution execution mode
+     * @return Result of the reduction
+     */
+    template <Arithmetic T, class... Rest, typename BinaryOp = std::plus<T>>
+    T reduce(Vector<T, Rest...> const &vec, std::type_identity_t<T> init = T{}, BinaryOp op = {},
+             Execution execution = Execution::Auto);
+
+    /**
+     * @brief Counts elements for which 'pred' returns "true"
+     * @param vec vector to check
+     * @param pred unary predicate, has to be free of side effects
+     * @param execution execution mode
+     * @return Count of the matching elements
+     */
+    template <Arithmetic T, class... Rest, typename UnaryPred>
+    size_t count_if(Vector<T, Rest...> const &vec, UnaryPred pred, Execution execution = Execution::Auto);
+
+    /**
+     * @brief Searches for the first element equal to 'value'
+     * @param vec vector to search in
+     * @param value value to search for
+     * @param execution execution mode
+     * @return Index of the first matching element or "vec.size()" if there is no such element
+     */
+    template <Arithmetic T, class... Rest>
+    size_t find(Vector<T, Rest...> const &vec, std::type_identity_t<T> value, Execution execution = Execution::Auto);
+}
+
+#endif // !VECTOR_ALGORITHMS_HPP
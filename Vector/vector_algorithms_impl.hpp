@@ -0,0 +1,344 @@
+#ifndef VECTOR_ALGORITHMS_IMPL_HPP
+#define VECTOR_ALGORITHMS_IMPL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "vector_algorithms.hpp"
+#include "vector_impl.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define VECTOR_ALGORITHMS_X86
+#define VECTOR_ALGORITHMS_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace bulk::detail
+{
+    /// @brief Fixed set of worker threads that run chunks of a single bulk operation at a time
+    class ThreadPool
+    {
+    public:
+        /// @return Pool with one worker less than hardware threads (calling thread works too)
+        static ThreadPool &instance()
+        {
+            static ThreadPool pool;
+            return pool;
+        }
+
+        /// @return Count of threads that take part in "run()"
+        size_t concurrency() const noexcept { return m_workers.size() + 1ul; }
+
+        /**
+         * @brief Runs 'task(i)' for each 'i' in [0, count) and waits until all of them are done.
+         * Calling thread takes part as well. Mustn't be called from inside of a task
+         * @param count count of tasks
+         * @param task task to run
+         */
+        template <typename Task>
+        void run(size_t count, Task const &task)
+        {
+            std::lock_guard<std::mutex> runLock(m_runMutex);
+            const std::function<void(size_t)> function{std::cref(task)};
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_task = &function;
+            m_next = 0ul;
+            m_count = count;
+            m_pending = count;
+            m_wake.notify_all();
+
+            while (m_next < m_count)
+                runNext(lock);
+            m_done.wait(lock, [this]()
+                        { return m_pending == 0ul; });
+            m_task = nullptr;
+        }
+
+    private:
+        std::vector<std::thread> m_workers;
+        std::mutex m_runMutex; // Only one operation at a time uses the pool
+        std::mutex m_mutex;    // Guards the state below
+        std::condition_variable m_wake, m_done;
+        std::function<void(size_t)> const *m_task{};
+        size_t m_next{}, m_count{}, m_pending{};
+        bool m_stop{};
+
+        ThreadPool()
+        {
+            const size_t threads{std::max(1u, std::thread::hardware_concurrency())};
+            for (size_t i{1ul}; i < threads; i++)
+                m_workers.emplace_back([this]()
+                                       { work(); });
+        }
+
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_wake.notify_all();
+            for (auto &worker : m_workers)
+                worker.join();
+        }
+
+        /// @brief Takes the next task, runs it without the lock held and marks it as done
+        void runNext(std::unique_lock<std::mutex> &lock)
+        {
+            const size_t index{m_next++};
+            const auto *task{m_task};
+            lock.unlock();
+            (*task)(index);
+            lock.lock();
+            if (--m_pending == 0ul)
+                m_done.notify_all();
+        }
+
+        void work()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while (true)
+            {
+                m_wake.wait(lock, [this]()
+                            { return m_stop || m_next < m_count; });
+                if (m_stop)
+                    return;
+                runNext(lock);
+            }
+        }
+    };
+
+    /// @return Count of chunks the range of 'size' elements is split into
+    inline size_t chunkCount(size_t size, Execution execution)
+    {
+        const bool parallel{execution == Execution::Parallel ||
+                            (execution == Execution::Auto && size >= kParallelThreshold)};
+        return parallel ? std::max(1ul, std::min(ThreadPool::instance().concurrency(), size)) : 1ul;
+    }
+
+    /**
+     * @brief Calls 'fn(begin, end, chunk)' for each of 'chunks' equal parts of [0, size)
+     * @param size count of elements
+     * @param chunks count of chunks, see "chunkCount()"
+     * @param fn function to call for each chunk
+     */
+    template <typename Fn>
+    void forEachChunk(size_t size, size_t chunks, Fn const &fn)
+    {
+        if (chunks == 1ul)
+            return fn(0ul, size, 0ul);
+        ThreadPool::instance().run(chunks, [&](size_t chunk)
+                                   { fn(size * chunk / chunks, size * (chunk + 1ul) / chunks, chunk); });
+    }
+
+    /// @return "true" if AVX2 kernels can be used on this CPU
+    inline bool hasAvx2() noexcept
+    {
+#ifdef VECTOR_ALGORITHMS_X86
+        static const bool kHasAvx2{__builtin_cpu_supports("avx2") != 0};
+        return kHasAvx2;
+#else
+        return false;
+#endif
+    }
+
+#ifdef VECTOR_ALGORITHMS_X86
+    /// @brief Instantiates 'Kernel::run()' compiled for AVX2
+    template <typename Kernel, typename... Args>
+    VECTOR_ALGORITHMS_AVX2 auto runAvx2(Args... args) { return Kernel::run(args...); }
+#endif
+
+    /// @brief Runs the best build of 'Kernel::run()' for the current CPU
+    template <typename Kernel, typename... Args>
+    auto runKernel(Args... args)
+    {
+#ifdef VECTOR_ALGORITHMS_X86
+        if (hasAvx2())
+            return runAvx2<Kernel>(args...);
+#endif
+        return Kernel::run(args...);
+    }
+
+    // Kernels are plain loops over raw pointers. They are force-inlined into "runAvx2()", so the
+    // same source is compiled twice: for the default target and for AVX2
+
+    struct FillKernel
+    {
+        template <typename T>
+        [[gnu::always_inline]] static void run(T *data, size_t size, T value)
+        {
+            for (size_t i{}; i < size; i++)
+                data[i] = value;
+        }
+    };
+
+    struct CopyKernel
+    {
+        template <typename T>
+        [[gnu::always_inline]] static void run(T const *src, T *dst, size_t size)
+        {
+            std::copy_n(src, size, dst);
+        }
+    };
+
+    struct TransformKernel
+    {
+        template <typename T, typename U, typename UnaryOp>
+        [[gnu::always_inline]] static void run(T const *src, U *dst, size_t size, UnaryOp op)
+        {
+            for (size_t i{}; i < size; i++)
+                dst[i] = static_cast<U>(op(src[i]));
+        }
+    };
+
+    struct ReduceKernel
+    {
+        // Independent accumulators (two AVX2 registers) break the dependency chain of a single
+        // accumulator, so the loop can be vectorized without reassociating floating point math
+        template <typename T, typename BinaryOp>
+        [[gnu::always_inline]] static T run(T const *data, size_t size, T init, BinaryOp op)
+        {
+            constexpr size_t kLanes{64ul / sizeof(T)};
+            size_t i{};
+            if (size >= kLanes)
+            {
+                T lanes[kLanes];
+                for (size_t j{}; j < kLanes; j++)
+                    lanes[j] = data[j];
+                for (i = kLanes; i + kLanes <= size; i += kLanes)
+                    for (size_t j{}; j < kLanes; j++)
+                        lanes[j] = op(lanes[j], data[i + j]);
+                for (size_t j{}; j < kLanes; j++)
+                    init = op(init, lanes[j]);
+            }
+            for (; i < size; i++)
+                init = op(init, data[i]);
+            return init;
+        }
+    };
+
+    struct CountIfKernel
+    {
+        template <typename T, typename UnaryPred>
+        [[gnu::always_inline]] static size_t run(T const *data, size_t size, UnaryPred pred)
+        {
+            size_t count{};
+            for (size_t i{}; i < size; i++)
+                count += pred(data[i]) ? 1ul : 0ul;
+            return count;
+        }
+    };
+
+    struct FindKernel
+    {
+        // Block is checked as a whole without branches, exact position is looked for only in a matching block
+        template <typename T>
+        [[gnu::always_inline]] static size_t run(T const *data, size_t size, T value)
+        {
+            constexpr size_t kBlock{256ul / sizeof(T)};
+            size_t i{};
+            for (; i + kBlock <= size; i += kBlock)
+            {
+                unsigned found{};
+                for (size_t j{}; j < kBlock; j++)
+                    found |= static_cast<unsigned>(data[i + j] == value);
+                if (found)
+                    break;
+            }
+            for (; i < size; i++)
+                if (data[i] == value)
+                    return i;
+            return size;
+        }
+    };
+}
+
+template <bulk::Arithmetic T, class... Rest>
+void bulk::fill(Vector<T, Rest...> &vec, std::type_identity_t<T> value, Execution execution)
+{
+    T *data{vec.data()};
+    detail::forEachChunk(vec.size(), detail::chunkCount(vec.size(), execution), [&](size_t begin, size_t end, size_t)
+                         { detail::runKernel<detail::FillKernel>(data + begin, end - begin, value); });
+}
+
+template <bulk::Arithmetic T, class... RestSrc, class... RestDst>
+void bulk::copy(Vector<T, RestSrc...> const &src, Vector<T, RestDst...> &dst, Execution execution)
+{
+    dst.resize(src.size());
+    T const *from{src.data()};
+    T *to{dst.data()};
+    detail::forEachChunk(src.size(), detail::chunkCount(src.size(), execution), [&](size_t begin, size_t end, size_t)
+                         { detail::runKernel<detail::CopyKernel>(from + begin, to + begin, end - begin); });
+}
+
+template <bulk::Arithmetic T, bulk::Arithmetic U, class... RestSrc, class... RestDst, typename UnaryOp>
+void bulk::transform(Vector<T, RestSrc...> const &src, Vector<U, RestDst...> &dst, UnaryOp op, Execution execution)
+{
+    dst.resize(src.size());
+    T const *from{src.data()};
+    U *to{dst.data()};
+    detail::forEachChunk(src.size(), detail::chunkCount(src.size(), execution), [&](size_t begin, size_t end, size_t)
+                         { detail::runKernel<detail::TransformKernel>(from + begin, to + begin, end - begin, op); });
+}
+
+template <bulk::Arithmetic T, class... Rest, typename BinaryOp>
+T bulk::reduce(Vector<T, Rest...> const &vec, std::type_identity_t<T> init, BinaryOp op, Execution execution)
+{
+    T const *data{vec.data()};
+    const size_t chunks{detail::chunkCount(vec.size(), execution)};
+    if (chunks == 1ul)
+        return detail::runKernel<detail::ReduceKernel>(data, vec.size(), init, op);
+
+    // Every chunk starts from its own first element, so 'init' is taken into account only once
+    std::vector<T> partial(chunks);
+    detail::forEachChunk(vec.size(), chunks, [&](size_t begin, size_t end, size_t chunk)
+                         { partial[chunk] = detail::runKernel<detail::ReduceKernel>(data + begin + 1ul, end - begin - 1ul, data[begin], op); });
+    for (T const &value : partial)
+        init = op(init, value);
+    return init;
+}
+
+template <bulk::Arithmetic T, class... Rest, typename UnaryPred>
+size_t bulk::count_if(Vector<T, Rest...> const &vec, UnaryPred pred, Execution execution)
+{
+    T const *data{vec.data()};
+    const size_t chunks{detail::chunkCount(vec.size(), execution)};
+    std::vector<size_t> partial(chunks);
+    detail::forEachChunk(vec.size(), chunks, [&](size_t begin, size_t end, size_t chunk)
+                         { partial[chunk] = detail::runKernel<detail::CountIfKernel>(data + begin, end - begin, pred); });
+
+    size_t count{};
+    for (size_t value : partial)
+        count += value;
+    return count;
+}
+
+template <bulk::Arithmetic T, class... Rest>
+size_t bulk::find(Vector<T, Rest...> const &vec, std::type_identity_t<T> value, Execution execution)
+{
+    T const *data{vec.data()};
+    const size_t chunks{detail::chunkCount(vec.size(), execution)};
+    if (chunks == 1ul)
+        return detail::runKernel<detail::FindKernel>(data, vec.size(), value);
+
+    // Chunk that starts after the already found element has nothing to look for
+    std::atomic<size_t> first{vec.size()};
+    detail::forEachChunk(vec.size(), chunks, [&](size_t begin, size_t end, size_t)
+                         {
+        if (begin >= first.load(std::memory_order_relaxed))
+            return;
+        const size_t index{begin + detail::runKernel<detail::FindKernel>(data + begin, end - begin, value)};
+        if (index == end)
+            return;
+        size_t current{first.load(std::memory_order_relaxed)};
+        while (index < current && !first.compare_exchange_weak(current, index, std::memory_order_relaxed))
+            ; });
+    return first.load();
+}
+
+#endif // !VECTOR_ALGORITHMS_IMPL_HPP
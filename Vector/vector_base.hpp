@@ -0,0 +1,283 @@
+#ifndef VECTOR_BASE_HPP
+#define VECTOR_BASE_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <span>
+#include <type_traits>
+
+#include "growth_policy.hpp"
+
+/**
+ * @brief Concept that checks if variable has output operator
+ * @tparam a variable to check
+ * @param os output stream
+ */
+template <typename T>
+concept Printable = requires(T a, std::ostream &os) {
+    {
+        os << a
+    } -> std::same_as<std::ostream &>;
+};
+
+/**
+ * @brief Trait that tells if an object of type 'T' can be moved to another address by copying its bytes,
+ * without calling move ctor at the new address and dtor at the old one.
+ * True for trivially copyable types, specialize it for own types that are safe to relocate bitwise.
+ * @tparam T type to check
+ */
+template <typename T>
+struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<T>>
+{
+};
+
+/// @brief 'std::unique_ptr' is just a pointer (and a deleter), moving it bitwise leaves nothing behind to destroy
+template <typename T, typename Deleter>
+struct is_trivially_relocatable<std::unique_ptr<T, Deleter>> : is_trivially_relocatable<Deleter>
+{
+};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+/**
+ * @brief Concept for allocators that can resize a block without copying it element by element.
+ * "reallocate(p, n, count)" returns the resized block with preserved bytes, or "nullptr" if it can't resize this
+ * block (then 'p' stays valid). See "HugePageAllocator"
+ */
+template <class Allocator, typename T>
+concept ReallocatingAllocator = requires(Allocator alloc, T *p, size_t n) {
+    {
+        alloc.reallocate(p, n, n)
+    } -> std::same_as<T *>;
+};
+
+/**
+ * @brief Storage and element access shared by "Vector" and "SmallVector".
+ * Keeps contiguous raw storage, only the first "size()" elements of which are constructed, and grows it
+ * by 'GrowthPolicy'. 'Derived' decides where the storage comes from: it has to provide
+ *     bool ownsStorage() const noexcept;
+ * that tells if the current storage was obtained from 'Allocator' (and so has to be returned to it on growth).
+ * Copying, moving and destruction are up to 'Derived'
+ * @tparam Derived vector type that inherits this class
+ * @tparam T type of the elements
+ * @tparam Allocator allocator of the storage
+ * @tparam GrowthPolicy how much capacity is added on growth, see "growth_policy.hpp"
+ */
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+class VectorBase
+{
+    // Restrictions on 'T' type. Other restrictions are within some method
+    static_assert(std::equality_comparable<T> && std::swappable<T>);
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = T const &;
+    using pointer = T *;
+    using const_pointer = T const *;
+    // Storage is contiguous, so plain pointers are contiguous iterators
+    using iterator = T *;
+    using const_iterator = T const *;
+
+    /**
+     * @brief Adding new element to the vector
+     * @tparam value value to add
+     */
+    void push_back(const T &value);
+
+    /**
+     * @brief Adding new element to the vector. Move version
+     * @tparam value value to add
+     */
+    constexpr void push_back(T &&value);
+
+    /**
+     * @brief Constructs a new element in place at the end of the vector
+     * @tparam Args types of arguments
+     * @param args arguments to forward to the constructor of the element
+     * @return A reference to the constructed element
+     * @throws "std::length_error" if the vector already holds "max_size()" elements
+     */
+    template <typename... Args>
+    constexpr T &emplace_back(Args &&...args);
+
+    /**
+     * @brief Destroys the last element of the vector
+     * @throws "std::out_of_range" if the vector is empty
+     */
+    constexpr void pop_back();
+
+    /**
+     * @brief Checker for emptiness of the vector
+     * @return "true" if vector is empty, otherwise "false"
+     */
+    [[nodiscard]] constexpr bool empty() const noexcept;
+
+    /// @return Size of the vector
+    constexpr size_t size() const noexcept;
+
+    /// @return Capacity of the vector - how many elements can it contain
+    constexpr size_t capacity() const noexcept;
+
+    /**
+     * @brief Increases capacity of the vector. Reallocates if 'capacity' is greater than the current one
+     * @param capacity new value of the capacity
+     * @throws "std::length_error" if 'capacity' is greater than "max_size()"
+     */
+    constexpr void reserve(size_t capacity);
+
+    /// @return Maximum number of elements the container is able to hold, limited by the allocator
+    constexpr size_t max_size() const noexcept;
+
+    /**
+     * @brief Access the element at the specified index with bounds checking
+     * @param index The index of the element to access
+     * @return A reference to the element at the specified index
+     * @throws "std::out_of_range" if the index is out of bounds
+     */
+    constexpr T &at(size_t index);
+
+    /**
+     * @brief Access the element at the specified index with bounds checking (const version)
+     * @param index The index of the element to access
+     * @return A constant reference to the element at the specified index
+     * @throws "std::out_of_range" if the index is out of bounds
+     */
+    constexpr T const &at(size_t index) const;
+
+    /**
+     * @brief Access the element at the specified index without bounds checking
+     * @param index The index of the element to access
+     * @return A reference to the element at the specified index
+     */
+    constexpr T &operator[](size_t index);
+
+    /**
+     * @brief Access the element at the specified index without bounds checking (const version)
+     * @param index The index of the element to access
+     * @return A constant reference to the element at the specified index
+     */
+    constexpr T const &operator[](size_t index) const;
+
+    /**
+     * @brief Returns a reference to the first element of the vector.
+     * This function provides access to the first element of the vector.
+     * If the vector is empty, it throws a std::out_of_range exception.
+     * @returns A reference to the first element
+     * @throws std::out_of_range if the vector is empty
+     */
+    constexpr T &front();
+
+    /**
+     * @brief Returns a reference to the first element of the vector (const version).
+     * This function provides read-only access to the first element of the vector.
+     * If the vector is empty, it throws a std::out_of_range exception.
+     * @returns A constant reference to the first element
+     * @throws std::out_of_range if the vector is empty
+     */
+    constexpr T const &front() const;
+
+    /**
+     * @brief Accesses the last element in the vector
+     * @returns A reference to the last element
+     */
+    constexpr T &back();
+
+    /**
+     * @brief Accesses the last element in the vector (const version)
+     * @returns A const reference to the last element
+     */
+    constexpr T const &back() const;
+
+    /// @return Pointer to the underlying storage. May be "nullptr" if vector has never held any element
+    constexpr T *data() noexcept;
+    constexpr T const *data() const noexcept;
+
+    /// @return Iterator to the first element
+    constexpr iterator begin() noexcept;
+    constexpr const_iterator begin() const noexcept;
+    constexpr const_iterator cbegin() const noexcept;
+
+    /// @return Iterator past the last element
+    constexpr iterator end() noexcept;
+    constexpr const_iterator end() const noexcept;
+    constexpr const_iterator cend() const noexcept;
+
+    /// @return View of all elements, e.g. for bulk APIs that take a pointer and a size
+    constexpr operator std::span<T>() noexcept;
+    constexpr operator std::span<T const>() const noexcept;
+
+    /// @brief Erases all elements from the vector. Capacity stays the same
+    constexpr void clear() noexcept;
+
+    /**
+     * @brief Resizes the container to contain 'new_size' elements.
+     * If the current size is greater than 'new_size', the container is reduced to its first 'new_size' elements.
+     * If the current size is less than 'new_size', additional default-inserted elements are appended
+     * @param new_size The new size of the container
+     */
+    constexpr void resize(size_t new_size);
+
+    /**
+     * @brief Resizes the container to contain 'new_size' elements.
+     * If the current size is greater than 'new_size', the container is reduced to its first 'new_size' elements.
+     * If the current size is less than 'new_size', additional default-inserted elements are appended.
+     * @param new_size The new size of the container
+     * @param value The value to initialize the new elements with
+     */
+    constexpr void resize(size_t new_size, T const &value);
+
+    /// @brief Prints all elements of the vector to the terminal
+    void print() const;
+
+protected:
+    using AllocTraits = std::allocator_traits<Allocator>;
+
+    T *m_data;                               // Storage, only first 'm_size' elements are constructed
+    size_t m_size;                           // Real size
+    size_t m_capacity;                       // Reserved size
+    [[no_unique_address]] Allocator m_alloc; // Allocator of the storage
+
+    /// @brief Ctor of the empty vector without storage
+    VectorBase() noexcept(std::is_nothrow_default_constructible_v<Allocator>);
+
+    /**
+     * @brief Ctor of the empty vector without storage
+     * @param alloc allocator of the storage
+     */
+    explicit VectorBase(Allocator &&alloc) noexcept;
+
+    /// @brief Dtor. Elements and storage are released by 'Derived'
+    ~VectorBase() = default;
+
+    /**
+     * @brief Asks 'GrowthPolicy' for the new capacity
+     * @param required count of elements the storage has to hold
+     * @return Capacity to grow to, at least 'required'
+     */
+    constexpr size_t grownCapacity(size_t required) const noexcept;
+
+    /**
+     * @brief Moves elements to the new storage and frees the old one if 'Derived' owns it. Trivially relocatable
+     * elements are moved with a single "memcpy()", others are moved one by one (copied if move ctor of 'T' can throw)
+     * @param data new storage, has to be able to hold at least 'm_size' elements
+     * @param capacity capacity of the new storage
+     */
+    void relocate(T *data, size_t capacity);
+
+    /**
+     * @brief Resizes the storage with "Allocator::reallocate()" if allocator and 'T' allow it
+     * @param capacity new capacity, not less than 'm_size'
+     * @return "true" if storage was resized, otherwise "false" and nothing changed
+     */
+    bool tryReallocate(size_t capacity);
+};
+
+#endif // !VECTOR_BASE_HPP
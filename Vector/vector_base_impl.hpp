@@ -0,0 +1,329 @@
+#ifndef VECTOR_BASE_IMPL_HPP
+#define VECTOR_BASE_IMPL_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "vector_base.hpp"
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+VectorBase<Derived, T, Allocator, GrowthPolicy>::VectorBase() noexcept(std::is_nothrow_default_constructible_v<Allocator>)
+    : m_data(nullptr), m_size(0ul), m_capacity(0ul) {}
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+VectorBase<Derived, T, Allocator, GrowthPolicy>::VectorBase(Allocator &&alloc) noexcept
+    : m_data(nullptr), m_size(0ul), m_capacity(0ul), m_alloc(std::move(alloc)) {}
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr size_t VectorBase<Derived, T, Allocator, GrowthPolicy>::grownCapacity(size_t required) const noexcept
+{
+    // Policy may overshoot near the limit, 'required' beyond it is left for "reserve()" to reject
+    return std::max(required, std::min(GrowthPolicy::template next<T>(m_capacity, required), max_size()));
+}
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+void VectorBase<Derived, T, Allocator, GrowthPolicy>::relocate(T *data, size_t capacity)
+{
+    if constexpr (is_trivially_relocatable_v<T>)
+    {
+        // Objects simply change their address, old ones mustn't be destroyed
+        if (m_size)
+            std::memcpy(static_cast<void *>(data), static_cast<void const *>(m_data), m_size * sizeof(T));
+    }
+    else
+    {
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+            std::uninitialized_move_n(m_data, m_size, data);
+        else
+            // Strong exception guarantee: if copying throws, old storage stays untouched
+            std::uninitialized_copy_n(m_data, m_size, data);
+        std::destroy_n(m_data, m_size);
+    }
+
+    if (static_cast<Derived const &>(*this).ownsStorage())
+        AllocTraits::deallocate(m_alloc, m_data, m_capacity);
+    m_data = data;
+    m_capacity = capacity;
+}
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+bool VectorBase<Derived, T, Allocator, GrowthPolicy>::tryReallocate(size_t capacity)
+{
+    if constexpr (ReallocatingAllocator<Allocator, T> && is_trivially_relocatable_v<T>)
+    {
+        // Only a block obtained from the allocator can be resized by it
+        if (!static_cast<Derived const &>(*this).ownsStorage())
+            return false;
+        if (T *data{m_alloc.reallocate(m_data, m_capacity, capacity)})
+        {
+            m_data = data;
+            m_capacity = capacity;
+            return true;
+        }
+    }
+    return false;
+}
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+void VectorBase<Derived, T, Allocator, GrowthPolicy>::push_back(const T &value)
+{
+    static_assert(std::copy_constructible<T>);
+    emplace_back(value);
+}
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr void VectorBase<Derived, T, Allocator, GrowthPolicy>::push_back(T &&value)
+{
+    static_assert(std::move_constructible<T>);
+    emplace_back(std::move(value));
+}
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+template <typename... Args>
+constexpr T &VectorBase<Derived, T, Allocator, GrowthPolicy>::emplace_back(Args &&...args)
+{
+    if (m_size < m_capacity)
+    {
+        // Size is increased only after the ctor succeeded, otherwise a throwing ctor leaves an unconstructed element
+        T &element{*std::construct_at(m_data + m_size, std::forward<Args>(args)...)};
+        ++m_size;
+        return element;
+    }
+
+    if (m_size == max_size())
+        throw std::length_error("emplace_back(): size reached max_size()");
+    const size_t capacity{grownCapacity(m_size + 1ul)};
+    if constexpr (ReallocatingAllocator<Allocator, T> && is_trivially_relocatable_v<T>)
+    {
+        // Storage may be resized by the allocator, so the new element is built aside first: 'args' may refer to an element
+        T value(std::forward<Args>(args)...);
+        reserve(capacity);
+        T &element{*std::construct_at(m_data + m_size, std::move(value))};
+        ++m_size;
+        return element;
+    }
+
+    // New element is constructed before relocation, because 'args' may refer to an element of this vector
+    T *data{AllocTraits::allocate(m_alloc, capacity)};
+    try
+    {
+        std::construct_at(data + m_size, std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        AllocTraits::deallocate(m_alloc, data, capacity);
+        throw;
+    }
+
+    try
+    {
+        relocate(data, capacity);
+    }
+    catch (...)
+    {
+        std::destroy_at(data + m_size);
+        AllocTraits::deallocate(m_alloc, data, capacity);
+        throw;
+    }
+    return m_data[m_size++];
+}
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr void VectorBase<Derived, T, Allocator, GrowthPolicy>::pop_back()
+{
+    if (empty())
+        throw std::out_of_range("pop_back(): vector is empty");
+    std::destroy_at(m_data + --m_size);
+}
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr bool VectorBase<Derived, T, Allocator, GrowthPolicy>::empty() const noexcept { return !m_size; }
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr size_t VectorBase<Derived, T, Allocator, GrowthPolicy>::size() const noexcept { return m_size; }
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr size_t VectorBase<Derived, T, Allocator, GrowthPolicy>::capacity() const noexcept { return m_capacity; }
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr void VectorBase<Derived, T, Allocator, GrowthPolicy>::reserve(size_t capacity)
+{
+    if (capacity > max_size())
+        throw std::length_error("reserve(): capacity exceeds max_size()");
+    if (capacity <= m_capacity || tryReallocate(capacity))
+        return;
+
+    T *data{AllocTraits::allocate(m_alloc, capacity)};
+    try
+    {
+        relocate(data, capacity);
+    }
+    catch (...)
+    {
+        AllocTraits::deallocate(m_alloc, data, capacity);
+        throw;
+    }
+}
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr size_t VectorBase<Derived, T, Allocator, GrowthPolicy>::max_size() const noexcept
+{
+    // Distance between iterators has to fit into 'difference_type' too
+    constexpr size_t kMaxDistance{static_cast<size_t>(std::numeric_limits<difference_type>::max()) / sizeof(T)};
+    return std::min(AllocTraits::max_size(m_alloc), kMaxDistance);
+}
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr T &VectorBase<Derived, T, Allocator, GrowthPolicy>::at(size_t index)
+{
+    if (index >= m_size)
+        throw std::out_of_range("Index out of bounds");
+    return m_data[index];
+}
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr T const &VectorBase<Derived, T, Allocator, GrowthPolicy>::at(size_t index) const
+{
+    if (index >= m_size)
+        throw std::out_of_range("Index out of bounds");
+    return m_data[index];
+}
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr T &VectorBase<Derived, T, Allocator, GrowthPolicy>::operator[](size_t index) { return m_data[index]; }
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr T const &VectorBase<Derived, T, Allocator, GrowthPolicy>::operator[](size_t index) const { return m_data[index]; }
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr T &VectorBase<Derived, T, Allocator, GrowthPolicy>::front()
+{
+    if (!m_size)
+        throw std::out_of_range("Vector is empty. Cannot access front element.");
+    return m_data[0];
+}
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr T const &VectorBase<Derived, T, Allocator, GrowthPolicy>::front() const
+{
+    if (!m_size)
+        throw std::out_of_range("Vector is empty. Cannot access front element.");
+    return m_data[0];
+}
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr T &VectorBase<Derived, T, Allocator, GrowthPolicy>::back()
+{
+    if (empty())
+        throw std::out_of_range("back(): vector is empty");
+    return m_data[m_size - 1];
+}
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr T const &VectorBase<Derived, T, Allocator, GrowthPolicy>::back() const
+{
+    if (empty())
+        throw std::out_of_range("back() const: vector is empty");
+    return m_data[m_size - 1];
+}
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr T *VectorBase<Derived, T, Allocator, GrowthPolicy>::data() noexcept { return m_data; }
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr T const *VectorBase<Derived, T, Allocator, GrowthPolicy>::data() const noexcept { return m_data; }
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr typename VectorBase<Derived, T, Allocator, GrowthPolicy>::iterator VectorBase<Derived, T, Allocator, GrowthPolicy>::begin() noexcept { return m_data; }
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr typename VectorBase<Derived, T, Allocator, GrowthPolicy>::const_iterator VectorBase<Derived, T, Allocator, GrowthPolicy>::begin() const noexcept { return m_data; }
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr typename VectorBase<Derived, T, Allocator, GrowthPolicy>::const_iterator VectorBase<Derived, T, Allocator, GrowthPolicy>::cbegin() const noexcept { return m_data; }
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr typename VectorBase<Derived, T, Allocator, GrowthPolicy>::iterator VectorBase<Derived, T, Allocator, GrowthPolicy>::end() noexcept { return m_data + m_size; }
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr typename VectorBase<Derived, T, Allocator, GrowthPolicy>::const_iterator VectorBase<Derived, T, Allocator, GrowthPolicy>::end() const noexcept { return m_data + m_size; }
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr typename VectorBase<Derived, T, Allocator, GrowthPolicy>::const_iterator VectorBase<Derived, T, Allocator, GrowthPolicy>::cend() const noexcept { return m_data + m_size; }
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr VectorBase<Derived, T, Allocator, GrowthPolicy>::operator std::span<T>() noexcept { return {m_data, m_size}; }
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr VectorBase<Derived, T, Allocator, GrowthPolicy>::operator std::span<T const>() const noexcept { return {m_data, m_size}; }
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr void VectorBase<Derived, T, Allocator, GrowthPolicy>::clear() noexcept
+{
+    std::destroy_n(m_data, m_size);
+    m_size = 0ul;
+}
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr void VectorBase<Derived, T, Allocator, GrowthPolicy>::resize(size_t new_size)
+{
+    if (new_size < m_size)
+    {
+        // If size is smaller, destroy the tail
+        std::destroy(m_data + new_size, m_data + m_size);
+        m_size = new_size;
+        return;
+    }
+
+    // If size is larger than the current capacity, we need to reallocate memory
+    if (new_size > m_capacity)
+        reserve(grownCapacity(new_size));
+    // Value-initialize the new elements
+    std::uninitialized_value_construct(m_data + m_size, m_data + new_size);
+    m_size = new_size;
+}
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+constexpr void VectorBase<Derived, T, Allocator, GrowthPolicy>::resize(size_t new_size, T const &value)
+{
+    // No need to resize, the size is the same
+    if (new_size == m_size)
+        return;
+    if (new_size < m_size)
+    {
+        // Resize down
+        std::destroy(m_data + new_size, m_data + m_size);
+        m_size = new_size;
+        return;
+    }
+    if (new_size <= m_capacity)
+    {
+        // Resize up without reallocation
+        std::uninitialized_fill(m_data + m_size, m_data + new_size, value);
+        m_size = new_size;
+    }
+    else
+    {
+        // Resize up with reallocation. 'value' is copied first, because it may refer to an element of this vector
+        T const copy(value);
+        reserve(grownCapacity(new_size));
+        std::uninitialized_fill(m_data + m_size, m_data + new_size, copy);
+        m_size = new_size;
+    }
+}
+
+template <class Derived, typename T, class Allocator, class GrowthPolicy>
+void VectorBase<Derived, T, Allocator, GrowthPolicy>::print() const
+{
+    static_assert(Printable<T>, "Type of the vector elements has to be printable");
+
+    for (size_t i{}; i < m_size; i++)
+        std::cout << m_data[i] << ' ';
+    std::endl(std::cout);
+}
+
+#endif // !VECTOR_BASE_IMPL_HPP
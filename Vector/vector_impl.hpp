@@ -1,257 +1,155 @@
 #ifndef VECTOR_IMPL_HPP
 #define VECTOR_IMPL_HPP
 
-#include <iostream>
-#include <stdexcept>
-#include <limits>
+#include <algorithm>
+#include <utility>
 
 #include "vector.hpp"
+#include "vector_base_impl.hpp"
 
-#define VECTOR_MAX_SIZE std::numeric_limits<int>::max()
-
-template <typename T>
-void Vector<T>::copyObj(Vector const &rhs)
+template <typename T, class Allocator, class GrowthPolicy>
+void Vector<T, Allocator, GrowthPolicy>::copyObj(Vector const &rhs)
 {
-    m_data = std::move(rhs.m_data);
+    m_data = rhs.m_size ? AllocTraits::allocate(m_alloc, rhs.m_size) : nullptr;
+    try
+    {
+        std::uninitialized_copy_n(rhs.m_data, rhs.m_size, m_data);
+    }
+    catch (...)
+    {
+        if (m_data)
+            AllocTraits::deallocate(m_alloc, m_data, rhs.m_size);
+        m_data = nullptr;
+        m_size = m_capacity = 0ul;
+        throw;
+    }
     m_size = rhs.m_size;
-    m_capacity = rhs.m_capacity;
+    m_capacity = rhs.m_size;
 }
 
-template <typename T>
-void Vector<T>::moveObj(Vector &&rhs) noexcept
+template <typename T, class Allocator, class GrowthPolicy>
+void Vector<T, Allocator, GrowthPolicy>::moveObj(Vector &&rhs) noexcept
 {
-    m_data = std::move(rhs.m_data);
-    m_size = std::move(rhs.m_size);
-    m_capacity = std::move(rhs.m_capacity);
+    m_data = std::exchange(rhs.m_data, nullptr);
+    m_size = std::exchange(rhs.m_size, 0ul);
+    m_capacity = std::exchange(rhs.m_capacity, 0ul);
 }
 
-template <typename T>
-void Vector<T>::clearObj(Vector &obj)
+template <typename T, class Allocator, class GrowthPolicy>
+void Vector<T, Allocator, GrowthPolicy>::clearObj(Vector &obj)
 {
-    obj.m_data.reset();
+    std::destroy_n(obj.m_data, obj.m_size);
+    if (obj.m_data)
+        AllocTraits::deallocate(obj.m_alloc, obj.m_data, obj.m_capacity);
+    obj.m_data = nullptr;
     obj.m_size = 0ul;
     obj.m_capacity = 0ul;
 }
 
-template <typename T>
-void Vector<T>::increaseCapacity() { m_capacity = m_size * 2ul; }
+template <typename T, class Allocator, class GrowthPolicy>
+bool Vector<T, Allocator, GrowthPolicy>::ownsStorage() const noexcept { return m_data != nullptr; }
+
+template <typename T, class Allocator, class GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>::Vector() : Base() {}
 
-template <typename T>
-Vector<T>::Vector() : m_size(0ul), m_capacity(1ul) { m_data.reset(); }
+template <typename T, class Allocator, class GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>::Vector(T const &data) : Vector() { this->emplace_back(data); }
 
-template <typename T>
-Vector<T>::Vector(T const &data) : m_data(new T(data)),
-                                   m_size(1ul) { increaseCapacity(); }
+template <typename T, class Allocator, class GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>::Vector(T &&data) : Vector() { this->emplace_back(std::move(data)); }
 
-template <typename T>
-Vector<T>::Vector(T &&data) noexcept : m_data(new T(std::move(data))),
-                                       m_size(1ul) { increaseCapacity(); }
+template <typename T, class Allocator, class GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>::Vector(Vector const &vec)
+    : Base(AllocTraits::select_on_container_copy_construction(vec.m_alloc)) { copyObj(vec); }
 
-template <typename T>
-Vector<T>::Vector(Vector const &vec) { copyObj(vec); }
+template <typename T, class Allocator, class GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>::Vector(Vector &&vec) noexcept : Base(std::move(vec.m_alloc)) { moveObj(std::move(vec)); }
 
-template <typename T>
-Vector<T>::Vector(Vector &&vec) noexcept { moveObj(std::move(vec)); }
+template <typename T, class Allocator, class GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>::~Vector() { clearObj(*this); }
 
-template <typename T>
-Vector<T> &Vector<T>::operator=(Vector const &vec)
+template <typename T, class Allocator, class GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy> &Vector<T, Allocator, GrowthPolicy>::operator=(Vector const &vec)
 {
     if (this == &vec)
         return *this;
+    clearObj(*this);
     copyObj(vec);
     return *this;
 }
 
-template <typename T>
-Vector<T> &Vector<T>::operator=(Vector &&vec) noexcept
+template <typename T, class Allocator, class GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy> &Vector<T, Allocator, GrowthPolicy>::operator=(Vector &&vec) noexcept
 {
     if (this == &vec)
         return *this;
-    moveObj(vec);
+    clearObj(*this);
+    moveObj(std::move(vec));
     return *this;
 }
 
-template <typename T>
-void Vector<T>::push_back(const T &value)
+template <typename T, class Allocator, class GrowthPolicy>
+void Vector<T, Allocator, GrowthPolicy>::shrink_to_fit()
 {
-    static_assert(std::copyable<T> && std::is_copy_assignable_v<T>);
-
-    if (m_size >= m_capacity)
+    if (m_size == m_capacity)
+        return;
+    if (!m_size)
     {
-        increaseCapacity();
-        std::unique_ptr<T[]> data = std::make_unique<T[]>(m_capacity);
-        for (size_t i{}; i < m_size; i++)
-            data.get()[i] = std::move(m_data.get()[i]);
-        m_data = std::move(data);
+        clearObj(*this);
+        return;
     }
-    m_data.get()[m_size++] = value;
-}
-
-template <typename T>
-constexpr void Vector<T>::push_back(T &&value)
-{
-    static_assert(std::movable<T> && std::is_move_assignable_v<T>);
+    if (this->tryReallocate(m_size))
+        return;
 
-    if (m_size >= m_capacity)
+    T *data{AllocTraits::allocate(m_alloc, m_size)};
+    try
     {
-        increaseCapacity();
-        std::unique_ptr<T[]> data = std::make_unique<T[]>(m_capacity);
-        for (size_t i{}; i < m_size; i++)
-            data.get()[i] = std::move(m_data.get()[i]);
-        m_data = std::move(data);
+        this->relocate(data, m_size);
     }
-    m_data.get()[m_size++] = std::move(value);
-}
-
-/* template <typename T>
-template <typename... Args>
-constexpr void Vector<T>::emplace_back(Args &&...args)
-{
-    if (m_size >= m_capacity)
-        increaseCapacity();
-    new (dynamic_cast<T *>(m_data.get() + m_size)) T(std::forward<Args>(args)...);
-    m_size += sizeof...(Args);
-}*/
-
-template <typename T>
-constexpr bool Vector<T>::empty() const noexcept { return !m_size; }
-
-template <typename T>
-constexpr size_t Vector<T>::size() const noexcept { return m_size; }
-
-template <typename T>
-constexpr size_t Vector<T>::capacity() const noexcept { return m_capacity; }
-
-template <typename T>
-constexpr void Vector<T>::reserve(size_t capacity)
-{
-    if (capacity < VECTOR_MAX_SIZE)
-        m_capacity = capacity;
-}
-
-template <typename T>
-constexpr size_t Vector<T>::max_size() const noexcept { return VECTOR_MAX_SIZE; }
-
-template <typename T>
-constexpr T &Vector<T>::at(size_t index)
-{
-    if (index >= m_size)
-        throw std::out_of_range("Index out of bounds");
-    return m_data[index];
-}
-
-template <typename T>
-constexpr T const &Vector<T>::at(size_t index) const
-{
-    if (index >= m_size)
-        throw std::out_of_range("Index out of bounds");
-    return m_data[index];
-}
-
-template <typename T>
-constexpr T &Vector<T>::operator[](size_t index) { return m_data[index]; }
-
-template <typename T>
-constexpr T const &Vector<T>::operator[](size_t index) const { return m_data[index]; }
-
-template <typename T>
-constexpr T &Vector<T>::front()
-{
-    if (!m_size)
-        throw std::out_of_range("Vector is empty. Cannot access front element.");
-    return m_data[0];
-}
-
-template <typename T>
-constexpr T const &Vector<T>::front() const
-{
-    if (!m_size)
-        throw std::out_of_range("Vector is empty. Cannot access front element.");
-    return m_data[0];
-}
-
-template <typename T>
-constexpr T &Vector<T>::back()
-{
-    if (empty())
-        throw std::out_of_range("back(): vector is empty");
-    return m_data[m_size - 1];
-}
-
-template <typename T>
-constexpr T const &Vector<T>::back() const
-{
-    if (empty())
-        throw std::out_of_range("back() const: vector is empty");
-    return m_data[m_size - 1];
-}
-
-template <typename T>
-constexpr void Vector<T>::clear() noexcept { clearObj(*this); }
-
-template <typename T>
-constexpr void Vector<T>::resize(size_t new_size)
-{
-    if (new_size < m_size)
-        // If size is smaller, just update the size
-        m_size = new_size;
-    else if (new_size > m_capacity)
+    catch (...)
     {
-        // If size is larger than the current capacity, we need to reallocate memory
-        // Call reserve to ensure enough capacity
-        reserve(new_size);
-        for (size_t i{m_size}; i < new_size; ++i)
-            // Default-initialize the new elements
-            m_data[i] = T();
-        m_size = new_size;
+        AllocTraits::deallocate(m_alloc, data, m_size);
+        throw;
     }
-    else
-        // If size is in the current capacity range, just update the size
-        m_size = new_size;
 }
 
-template <typename T>
-constexpr void Vector<T>::resize(size_t new_size, T const &value)
+template <typename T, class Allocator, class GrowthPolicy>
+template <std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+typename Vector<T, Allocator, GrowthPolicy>::iterator Vector<T, Allocator, GrowthPolicy>::insert(const_iterator pos, InputIt first, Sentinel last)
 {
-    // No need to resize, the size is the same
-    if (new_size == m_size)
-        return;
-    if (new_size < m_size)
-    {
-        // Resize down
-        m_size = new_size;
-        return;
-    }
-    if (new_size <= m_capacity)
+    const size_t offset{static_cast<size_t>(pos - m_data)};
+    const size_t oldSize{m_size};
+
+    if constexpr (std::forward_iterator<InputIt>)
     {
-        // Resize up without reallocation
-        for (size_t i{m_size}; i < new_size; ++i)
-            m_data[i] = value;
-        m_size = new_size;
+        const size_t count{static_cast<size_t>(std::ranges::distance(first, last))};
+        if (m_size + count > m_capacity)
+            this->reserve(this->grownCapacity(m_size + count));
+        std::ranges::uninitialized_copy(first, last, m_data + m_size, m_data + m_size + count);
+        m_size += count;
     }
     else
     {
-        // Resize up with reallocation
-        size_t newCapacity{std::max(new_size, m_capacity * 2)};
-        std::unique_ptr<T[]> newData{std::make_unique<T[]>(newCapacity)};
-        for (size_t i{}; i < m_size; ++i)
-            newData[i] = m_data[i];
-        for (size_t i{m_size}; i < new_size; ++i)
-            newData[i] = value;
-        m_data = std::move(newData);
-        m_capacity = newCapacity;
-        m_size = new_size;
+        // Length of a single-pass range is unknown, so it can only grow element by element
+        try
+        {
+            for (; first != last; ++first)
+                this->emplace_back(*first);
+        }
+        catch (...)
+        {
+            std::destroy(m_data + oldSize, m_data + m_size);
+            m_size = oldSize;
+            throw;
+        }
     }
-}
 
-template <typename T>
-void Vector<T>::print() const
-{
-    static_assert(Printable<T>, "Type of the vector elements has to be printable");
-
-    for (size_t i{}; i < m_size; i++)
-        std::cout << m_data.get()[i] << ' ';
-    std::endl(std::cout);
+    std::rotate(m_data + offset, m_data + oldSize, m_data + m_size);
+    return m_data + offset;
 }
 
+template <typename T, class Allocator, class GrowthPolicy>
+template <std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+void Vector<T, Allocator, GrowthPolicy>::append(InputIt first, Sentinel last) { insert(this->end(), std::move(first), std::move(last)); }
+
 #endif // !VECTOR_IMPL_HPP